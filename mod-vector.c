@@ -29,12 +29,184 @@
 
 #include "sys-vector.h"
 
+#include <float.h>  // FLT_MAX
+
+
+//=//// COMPRESSED STORAGE ////////////////////////////////////////////////=//
+//
+// The BLOB! of a compressed vector is laid out as:
+//
+//     uint64_t                     element count (VAL_VECTOR_COMPRESSED_LEN)
+//     VectorBlockHead[num_blocks]  one per VECTOR_BLOCK_LEN elements
+//     packed bits for each block   followed by VECTOR_PACK_PADDING zero bytes
+//
+// In a "frame of reference" block, element I is `reference + packed[I]`,
+// where the reference is the block's minimum and each packed[I] takes `bits`
+// bits.  In a delta block, element 0 is `first`, and element I is element
+// I - 1 plus `reference + packed[I]` (the reference is the minimum delta).
+//
+// Because each block is independent, random access only has to decode one
+// value (or one block, if delta coded) instead of the whole vector.
+//
+// 1. Bits are packed little endian, but read a byte at a time so it doesn't
+//    matter what the machine's endianness is.  Compilers turn the loop into
+//    a single load on little endian machines.  A value starting anywhere in
+//    a byte can span 9 bytes, hence the padding after the packed data.
+//
+// 2. All arithmetic is done as uint64_t so that it wraps instead of having
+//    undefined behavior when the range of a block doesn't fit in int64_t.
+//
+
+#define VECTOR_BLOCK_LEN  128  // elements per compressed block
+#define VECTOR_PACK_PADDING  8  // so reads of the last value can overrun
+
+typedef struct {
+    int64_t reference;  // minimum value (or minimum delta if delta coded)
+    int64_t first;  // first value of block, if delta coded
+    uint32_t offset;  // of the packed bits, from the start of the BLOB!
+    Byte bits;  // bits per packed value, 0 to 64
+    Byte delta;  // nonzero if delta coded
+    Byte unused[2];
+} VectorBlockHead;
+
+#define VECTOR_COMPRESSED_HEAD_SIZE  sizeof(uint64_t)
+
+
+static void Get_Vector_Block_Head(
+    VectorBlockHead* head,
+    const Byte* data,  // head of compressed BLOB!
+    REBLEN block
+){
+    memcpy(
+        head,
+        data + VECTOR_COMPRESSED_HEAD_SIZE + (block * sizeof(VectorBlockHead)),
+        sizeof(VectorBlockHead)
+    );
+}
+
+
+INLINE uint64_t Unpack_Bits(const Byte* packed, REBLEN i, Byte bits)
+{
+    if (bits == 0)
+        return 0;
+
+    uint64_t bitpos = cast(uint64_t, i) * bits;
+    const Byte* at = packed + (bitpos / 8);
+    int shift = bitpos % 8;
+
+    uint64_t u = 0;
+    int k;
+    for (k = 0; k < 8; ++k)  // see [1]
+        u |= cast(uint64_t, at[k]) << (8 * k);
+
+    u >>= shift;
+    if (shift + bits > 64)
+        u |= cast(uint64_t, at[8]) << (64 - shift);
+
+    if (bits < 64)
+        u &= (cast(uint64_t, 1) << bits) - 1;
+    return u;
+}
+
+
+static void Decode_Vector_Block(
+    int64_t* out,
+    const Byte* data,  // head of compressed BLOB!
+    const VectorBlockHead* head,
+    REBLEN n  // number of elements in block
+){
+    const Byte* packed = data + head->offset;
+    uint64_t reference = head->reference;
+    REBLEN i;
+
+    if (not head->delta) {
+        for (i = 0; i < n; ++i)
+            out[i] = cast(int64_t,
+                reference + Unpack_Bits(packed, i, head->bits)
+            );
+        return;
+    }
+
+    uint64_t value = head->first;  // uint64_t math, see [2]
+    out[0] = cast(int64_t, value);
+    for (i = 1; i < n; ++i) {
+        value += reference + Unpack_Bits(packed, i, head->bits);
+        out[i] = cast(int64_t, value);
+    }
+}
+
+
+static int64_t Get_Compressed_At(const Cell* vec, REBLEN n)
+{
+    assert(n < VAL_VECTOR_COMPRESSED_LEN(vec));
+
+    const Byte* data = Binary_Head(Cell_Binary(VAL_VECTOR_BLOB(vec)));
+
+    VectorBlockHead head;
+    Get_Vector_Block_Head(&head, data, n / VECTOR_BLOCK_LEN);
+
+    REBLEN i = n % VECTOR_BLOCK_LEN;
+    const Byte* packed = data + head.offset;
+
+    if (not head.delta)
+        return cast(int64_t,
+            cast(uint64_t, head.reference) + Unpack_Bits(packed, i, head.bits)
+        );
+
+    uint64_t value = head.first;
+    REBLEN k;
+    for (k = 1; k <= i; ++k)
+        value += cast(uint64_t, head.reference)
+            + Unpack_Bits(packed, k, head.bits);
+    return cast(int64_t, value);
+}
+
+
+static void Load_Compressed_Int64s(
+    int64_t* buf,
+    const Cell* vec,
+    REBLEN index,
+    REBLEN count
+){
+    const Byte* data = Binary_Head(Cell_Binary(VAL_VECTOR_BLOB(vec)));
+    REBLEN len = VAL_VECTOR_COMPRESSED_LEN(vec);
+    assert(index + count <= len);
+
+    int64_t block_buf[VECTOR_BLOCK_LEN];
+
+    while (count != 0) {
+        REBLEN block = index / VECTOR_BLOCK_LEN;
+        REBLEN start = block * VECTOR_BLOCK_LEN;
+        REBLEN n = MIN(len - start, VECTOR_BLOCK_LEN);
+
+        VectorBlockHead head;
+        Get_Vector_Block_Head(&head, data, block);
+
+        REBLEN skip = index - start;
+        REBLEN take = MIN(n - skip, count);
+
+        if (skip == 0 and take == n)
+            Decode_Vector_Block(buf, data, &head, n);  // decode in place
+        else {
+            Decode_Vector_Block(block_buf, data, &head, n);
+            memcpy(buf, block_buf + skip, take * sizeof(int64_t));
+        }
+
+        buf += take;
+        index += take;
+        count -= take;
+    }
+}
+
 
 // Ren-C vectors are built on type of BLOB!.  This means that the memory
 // must be read via memcpy() in order to avoid strict aliasing violations.
 //
 static Element* Get_Vector_At(Sink(Element) out, const Cell* vec, REBLEN n)
 {
+    if (Is_Vector_Compressed(vec))
+        return Init_Integer(out, Get_Compressed_At(vec, n));
+
     Byte* data = VAL_VECTOR_HEAD(vec);
 
     bool integral = VAL_VECTOR_INTEGRAL(vec);
@@ -109,6 +281,20 @@ static Element* Get_Vector_At(Sink(Element) out, const Cell* vec, REBLEN n)
 }
 
 
+static Error* Error_Vector_Out_Of_Range(const Element* set, const Cell* vec)
+{
+    return Cell_Error(rebValue("make warning! [",
+        set, "-[out of range for]- unspaced [",
+            rebI(VAL_VECTOR_BITSIZE(vec)), "{-bit}]",
+            rebT(VAL_VECTOR_SIGN(vec) ? "signed" : "unsigned"),
+            "-[VECTOR! type]-",
+    "]"));
+}
+
+
+// 1. Decimals going into integral vectors are truncated toward zero, as a C
+//    cast would do.  (CONVERT-VECTOR offers other rounding modes.)
+//
 static Option(Error*) Trap_Set_Vector_At(
     Cell* vec,
     REBLEN n,
@@ -133,8 +319,9 @@ static Option(Error*) Trap_Set_Vector_At(
 
         switch (bitsize) {
           case 32: {
-            // Can't be "out of range", just loses precision
-            REBD32 d = cast(REBD32, d64);
+            if (d64 > FLT_MAX or d64 < -FLT_MAX)  // inf/NaN are representable
+                goto out_of_range;
+            REBD32 d = cast(REBD32, d64);  // in range, just loses precision
             memcpy(cast(REBD32*, data) + n, &d, sizeof(d));
             return SUCCESS; }
 
@@ -147,9 +334,12 @@ static Option(Error*) Trap_Set_Vector_At(
         int64_t i64;
         if (Is_Integer(set))
             i64 = VAL_INT64(set);
-        else {
+        else {  // truncate, see [1]
             assert(Is_Decimal(set));
-            i64 = cast(int32_t, VAL_DECIMAL(set));
+            REBDEC d = VAL_DECIMAL(set);
+            if (not (d >= -9223372036854775808.0 and d < 9223372036854775808.0))
+                goto out_of_range;  // also catches NaN
+            i64 = cast(int64_t, d);
         }
 
         if (sign) {
@@ -208,7 +398,7 @@ static Option(Error*) Trap_Set_Vector_At(
                 return SUCCESS; }
 
               case 64: {
-                uint32_t u = cast(uint32_t, i64);
+                uint64_t u = cast(uint64_t, i64);
                 memcpy(cast(uint64_t*, data) + n, &u, sizeof(u));
                 return SUCCESS; }
             }
@@ -217,10 +407,7 @@ static Option(Error*) Trap_Set_Vector_At(
 
   out_of_range:
 
-    return Cell_Error(rebValue("make warning! [",
-        set, "-[out of range for]- unspaced [", rebI(bitsize), "{-bit}]",
-            rebT(sign ? "signed" : "unsigned"), "-[VECTOR! type]-",
-    "]"));
+    return Error_Vector_Out_Of_Range(set, vec);
 }
 
 
@@ -262,202 +449,1821 @@ static Option(Error*) Trap_Set_Vector_Row(
 
 
 
-// Convert a vector to a block (no calls at present)
+// Vectors whose data fits in a cell's payload are made inline, so they only
+// cost one allocation (the pairing) instead of a pairing and a Binary.  The
+// elements start out zeroed.
 //
-static Array* Vector_To_Array(const Element* vec)
-{
-    USED(&Vector_To_Array);
-
-    REBLEN len = Series_Len_At(vec);
-    assert(len >= 0);
-
-    Array* arr = Make_Source(len);
-    Element* dest = Array_Head(arr);
-    REBLEN n;
-    for (n = Series_Index(vec); n < Series_Len_Head(vec); ++n, ++dest)
-        Get_Vector_At(dest, vec, n);
+// !!! No VECTOR! operation currently grows a vector in place, so an inline
+// vector stays inline for its lifetime.  If growth is added, it would have to
+// promote to a Binary (Init_Blob() into the first cell, clear the flag).
+//
+static Element* Make_Vector(
+    Sink(Element) out,
+    REBLEN len,
+    bool sign,
+    bool integral,
+    Byte bitsize
+){
+    Size size = len * (bitsize / 8);
+    if (size <= VECTOR_INLINE_CAPACITY)
+        return Init_Vector_Inline(out, size, sign, integral, bitsize);
 
-    Set_Flex_Len(arr, len);
-    assert(dest == Array_Tail(arr));
+    Binary* bin = Make_Binary(size);
+    memset(Binary_Head(bin), 0, size);
+    Term_Binary_Len(bin, size);
 
-    return arr;
+    return Init_Vector(out, bin, sign, integral, bitsize);
 }
 
 
-// !!! Comparison in R3-Alpha was an area that was not well developed.  Ren-C
-// has EQUAL? and LESSER? and builds on that (like Ord and Eq in Haskell, or
-// sorting only on operator< and operator== in C++)
+//=//// BULK ELEMENT ACCESS ///////////////////////////////////////////////=//
 //
-// For now just define EQUAL?
+// Whole-vector operations don't go through Get_Vector_At()/Trap_Set_Vector_At()
+// and boxed Cells.  Instead they move fixed-size chunks of elements between
+// the vector and a C array of int64_t (for integral data) or double (for
+// decimal data).  Each of those loops is specialized to one C type, so there
+// is no per-element switch() and the compiler is free to vectorize the
+// widening and narrowing.
+//
+// 1. Ren-C INTEGER! is 64-bit signed, so unsigned 64-bit vector elements are
+//    only meaningful up to INT64_MAX (see Get_Vector_At()).  Bigger values
+//    come back reinterpreted as negative int64_t.
+//
+// 2. Once the range has been checked, storing a value is just keeping its
+//    low bits...which is the same for signed and unsigned types, and is
+//    well-defined in C when done through the unsigned type.
 //
-IMPLEMENT_GENERIC(EQUAL_Q, Is_Vector)
-{
-    INCLUDE_PARAMS_OF_EQUAL_Q;
-
-    Element* v1 = Element_ARG(VALUE1);
-    Element* v2 = Element_ARG(VALUE2);
-    UNUSED(ARG(RELAX));
 
-    bool non_integer1 = not VAL_VECTOR_INTEGRAL(v1);
-    bool non_integer2 = not VAL_VECTOR_INTEGRAL(v2);
-    if (non_integer1 != non_integer2)
-        return fail (Error_Not_Same_Type_Raw());  // !!! is thisnecessary?
+#define VECTOR_CHUNK_LEN  256  // elements per chunk in bulk operations
+
+typedef enum {
+    VECTOR_OVERFLOW_ERROR,  // out of range values are an error (the default)
+    VECTOR_OVERFLOW_SATURATE,  // clamp to the nearest representable value
+    VECTOR_OVERFLOW_WRAP  // keep low bits (decimals overflow to infinity)
+} VectorOverflow;
+
+typedef enum {
+    VECTOR_ROUND_TRUNCATE,  // toward zero (C cast semantics, the default)
+    VECTOR_ROUND_NEAREST,  // halves away from zero
+    VECTOR_ROUND_FLOOR  // toward negative infinity
+} VectorRounding;
+
+#define LOAD_VECTOR_CHUNK(T) do { \
+    T tmp[VECTOR_CHUNK_LEN]; \
+    memcpy(tmp, data + (index * sizeof(T)), count * sizeof(T)); \
+    for (i = 0; i < count; ++i) \
+        buf[i] = tmp[i]; \
+} while (0)
+
+#define STORE_VECTOR_CHUNK(T) do { \
+    T tmp[VECTOR_CHUNK_LEN]; \
+    for (i = 0; i < count; ++i) \
+        tmp[i] = cast(T, buf[i]); \
+    memcpy(data + (index * sizeof(T)), tmp, count * sizeof(T)); \
+} while (0)
+
+
+static void Load_Vector_Int64s(
+    int64_t* buf,
+    const Cell* vec,
+    REBLEN index,
+    REBLEN count
+){
+    assert(VAL_VECTOR_INTEGRAL(vec));
+    assert(count <= VECTOR_CHUNK_LEN);
 
-    REBLEN l1 = VAL_VECTOR_LEN_AT(v1);
-    REBLEN l2 = VAL_VECTOR_LEN_AT(v2);
-    REBLEN len = MIN(l1, l2);
+    if (Is_Vector_Compressed(vec)) {
+        Load_Compressed_Int64s(buf, vec, index, count);
+        return;
+    }
 
-    DECLARE_ELEMENT (temp1);
-    DECLARE_ELEMENT (temp2);
+    const Byte* data = VAL_VECTOR_HEAD_CONST(vec);
+    REBLEN i;
 
-    REBLEN n;
-    for (n = 0; n < len; n++) {
-        Get_Vector_At(temp1, v1, n + VAL_VECTOR_INDEX(v1));
-        Get_Vector_At(temp2, v2, n + VAL_VECTOR_INDEX(v2));
-        if (not rebUnboxLogic(CANON(EQUAL_Q), temp1, temp2))
-            return LOGIC(false);
+    if (VAL_VECTOR_SIGN(vec)) {
+        switch (VAL_VECTOR_BITSIZE(vec)) {
+          case 8: LOAD_VECTOR_CHUNK(int8_t); return;
+          case 16: LOAD_VECTOR_CHUNK(int16_t); return;
+          case 32: LOAD_VECTOR_CHUNK(int32_t); return;
+          case 64: LOAD_VECTOR_CHUNK(int64_t); return;
+        }
+    }
+    else {
+        switch (VAL_VECTOR_BITSIZE(vec)) {
+          case 8: LOAD_VECTOR_CHUNK(uint8_t); return;
+          case 16: LOAD_VECTOR_CHUNK(uint16_t); return;
+          case 32: LOAD_VECTOR_CHUNK(uint32_t); return;
+          case 64: LOAD_VECTOR_CHUNK(int64_t); return;  // see [1]
+        }
     }
 
-    return LOGIC(true);
+    crash ("Unsupported vector element sign/type/size combination");
 }
 
 
-// !!! R3-Alpha code did this shuffle via the bits in the vector, not by
-// extracting into values.  This could use Byte* access to get a similar
-// effect if it were a priority.  Extract and reinsert Cells for now.
+// Any vector can be loaded as decimals (integers are converted).
 //
-IMPLEMENT_GENERIC(SHUFFLE, Is_Vector)
-{
-    INCLUDE_PARAMS_OF_SHUFFLE;
-
-    Element* vec = Element_ARG(SERIES);
-    bool secure = did ARG(SECURE);
+static void Load_Vector_Decimals(
+    REBDEC* buf,
+    const Cell* vec,
+    REBLEN index,
+    REBLEN count
+){
+    assert(count <= VECTOR_CHUNK_LEN);
 
-    REBLEN idx = VAL_VECTOR_INDEX(vec);
+    REBLEN i;
 
-    DECLARE_ELEMENT (temp1);
-    DECLARE_ELEMENT (temp2);
+    if (not VAL_VECTOR_INTEGRAL(vec)) {
+        const Byte* data = VAL_VECTOR_HEAD_CONST(vec);
+        switch (VAL_VECTOR_BITSIZE(vec)) {
+          case 32: LOAD_VECTOR_CHUNK(REBD32); return;
+          case 64: memcpy(buf, data + (index * 8), count * 8); return;
+        }
+    }
+    else {
+        int64_t ints[VECTOR_CHUNK_LEN];
+        Load_Vector_Int64s(ints, vec, index, count);
+        for (i = 0; i < count; ++i)
+            buf[i] = cast(REBDEC, ints[i]);
+        return;
+    }
 
-    REBLEN n;
-    for (n = VAL_VECTOR_LEN_AT(vec); n > 1;) {
-        REBLEN k = idx + cast(REBLEN, Random_Int(secure)) % n;
-        n--;
+    crash ("Unsupported vector element sign/type/size combination");
+}
 
-        Get_Vector_At(temp1, vec, k);
-        Get_Vector_At(temp2, vec, n + idx);
 
-        Option(Error*) e;
+// Casting a double outside of float's range to float is undefined behavior,
+// so 32-bit stores check finite values against FLT_MAX first.  Saturating
+// clamps to +/-FLT_MAX, and "wrapping" gives the +/-infinity that IEEE float
+// arithmetic overflows to.  (Infinities and NaN themselves are in range.)
+//
+static Option(Error*) Trap_Store_Vector_Decimals(
+    Cell* vec,
+    REBLEN index,
+    REBDEC* buf,  // may be modified (clamped) if out of range
+    REBLEN count,
+    VectorOverflow overflow
+){
+    assert(not VAL_VECTOR_INTEGRAL(vec));
+    assert(count <= VECTOR_CHUNK_LEN);
 
-        e = Trap_Set_Vector_At(vec, k, temp2);
-        assert(not e);
-        UNUSED(e);
+    Byte* data = VAL_VECTOR_HEAD(vec);
+    REBLEN i;
+
+    switch (VAL_VECTOR_BITSIZE(vec)) {
+      case 32:
+        for (i = 0; i < count; ++i) {
+            if (buf[i] <= FLT_MAX and buf[i] >= -FLT_MAX)
+                continue;  // in range
+            if (buf[i] != buf[i] or buf[i] == HUGE_VAL or buf[i] == -HUGE_VAL)
+                continue;  // NaN or infinity, representable as float
+
+            switch (overflow) {
+              case VECTOR_OVERFLOW_ERROR: {
+                DECLARE_ELEMENT (temp);
+                Init_Decimal(temp, buf[i]);
+                return Error_Vector_Out_Of_Range(temp, vec); }
+
+              case VECTOR_OVERFLOW_SATURATE:
+                buf[i] = buf[i] > 0 ? FLT_MAX : -FLT_MAX;
+                break;
+
+              case VECTOR_OVERFLOW_WRAP:
+                buf[i] = buf[i] > 0 ? HUGE_VAL : -HUGE_VAL;
+                break;
+            }
+        }
+        STORE_VECTOR_CHUNK(REBD32);  // now in range, just loses precision
+        return SUCCESS;
 
-        e = Trap_Set_Vector_At(vec, n + idx, temp1);
-        assert(not e);
-        UNUSED(e);
+      case 64:
+        memcpy(data + (index * 8), buf, count * 8);
+        return SUCCESS;
     }
 
-    return COPY(vec);
+    crash ("Unsupported vector element sign/type/size combination");
 }
 
 
-IMPLEMENT_GENERIC(MAKE, Is_Vector)
+static void Get_Vector_Int64_Range(int64_t* min, int64_t* max, const Cell* vec)
 {
-    INCLUDE_PARAMS_OF_MAKE;
-    UNUSED(ARG(TYPE));
-
-    Element* spec = Element_ARG(DEF);
+    assert(VAL_VECTOR_INTEGRAL(vec));
 
-    if (Is_Integer(spec) and not Is_Decimal(spec)) {
-        REBINT len = Int32s(spec, 0);
-        if (len < 0)
-            panic (PARAM(DEF));
+    Byte bitsize = VAL_VECTOR_BITSIZE(vec);
+    if (VAL_VECTOR_SIGN(vec)) {
+        if (bitsize == 64) {
+            *min = INT64_MIN;
+            *max = INT64_MAX;
+        }
+        else {
+            *max = (cast(int64_t, 1) << (bitsize - 1)) - 1;
+            *min = -(*max) - 1;
+        }
+    }
+    else {
+        *min = 0;
+        *max = (bitsize == 64)
+            ? INT64_MAX  // see [1]
+            : (cast(int64_t, 1) << bitsize) - 1;
+    }
+}
 
-        Byte bitsize = 32;
-        REBLEN num_bytes = (len * bitsize) / 8;
-        Binary* bin = Make_Binary(num_bytes);
-        memset(Binary_Head(bin), 0, num_bytes);
-        Term_Binary_Len(bin, num_bytes);
 
-        const bool sign = true;
-        const bool integral = true;
-        return Init_Vector(OUT, bin, sign, integral, bitsize);
-    }
+// Stores are done by keeping the low bits, see [2].  Range checking has to
+// happen before that, according to the overflow mode.
+//
+static Option(Error*) Trap_Store_Vector_Int64s(
+    Cell* vec,
+    REBLEN index,
+    int64_t* buf,  // may be modified (clamped) if saturating
+    REBLEN count,
+    VectorOverflow overflow
+){
+    assert(VAL_VECTOR_INTEGRAL(vec));
+    assert(count <= VECTOR_CHUNK_LEN);
 
-    if (not Is_Block(spec))
-        panic (PARAM(DEF));
+    REBLEN i;
 
-  //=//// MAKE VECTOR FROM A BLOCK! SPEC //////////////////////////////////=//
+    if (overflow != VECTOR_OVERFLOW_WRAP) {
+        int64_t min;
+        int64_t max;
+        Get_Vector_Int64_Range(&min, &max, vec);
 
-    // Make a vector from a block spec.  Binding isn't technically required
-    // if we're only examining the symbols literally.
-    //
-    //    make vector! [integer! 32 100]
-    //    make vector! [decimal! 64 100]
-    //    make vector! [unsigned integer! 32]
-    //    Fields:
-    //         signed:     signed, unsigned
-    //         datatypes:  integer, decimal
-    //         dimensions: 1 - N
-    //         bitsize:    1, 8, 16, 32, 64
-    //         size:       integer units
-    //         init:        block of values
-    //
-    // 1. !!! Note: VECTOR! was an ANY-SERIES!.  But as a user-defined type,
-    //    it is being separated from being the kind of thing that knows how
-    //    series internals are implemented.  It's not clear that user-defined
-    //    types like vectors will be positional.  VAL_VECTOR_INDEX() is always
-    //    0 for now.
+        if (overflow == VECTOR_OVERFLOW_SATURATE) {
+            for (i = 0; i < count; ++i)
+                buf[i] = buf[i] < min ? min : buf[i] > max ? max : buf[i];
+        }
+        else {
+            assert(overflow == VECTOR_OVERFLOW_ERROR);
+            for (i = 0; i < count; ++i) {
+                if (buf[i] < min or buf[i] > max) {
+                    DECLARE_ELEMENT (temp);
+                    Init_Integer(temp, buf[i]);
+                    return Error_Vector_Out_Of_Range(temp, vec);
+                }
+            }
+        }
+    }
 
-    const Element* tail;
-    const Element* item = List_At(&tail, spec);
+    Byte* data = VAL_VECTOR_HEAD(vec);
 
-    bool sign = true;  // default to signed, not unsigned
-    if (
-        item != tail
-        and Is_Word(item) and Word_Id(item) == EXT_SYM_UNSIGNED
-    ){
-        sign = false;
-        ++item;
+    switch (VAL_VECTOR_BITSIZE(vec)) {
+      case 8: STORE_VECTOR_CHUNK(uint8_t); return SUCCESS;
+      case 16: STORE_VECTOR_CHUNK(uint16_t); return SUCCESS;
+      case 32: STORE_VECTOR_CHUNK(uint32_t); return SUCCESS;
+      case 64: STORE_VECTOR_CHUNK(uint64_t); return SUCCESS;
     }
 
-    bool integral = false;  // default to integer, not floating point
-    if (item == tail or not Is_Word(item))
-        panic (item);
+    crash ("Unsupported vector element sign/type/size combination");
+}
 
-    if (Word_Id(item) == SYM_INTEGER_X)  // e_X_clamation (INTEGER!)
-        integral = true;
-    else if (Word_Id(item) == SYM_DECIMAL_X) {  // (DECIMAL!)
-        integral = false;
-        if (not sign)
-            panic ("VECTOR!: C doesn't have unsigned floating points");
+
+// Turn decimals into integers for storing in the integral vector `vec`.
+// Saturation clamps to that vector's range (NaN goes to 0).  When wrapping,
+// only values that fit in 64 bits can be wrapped--others are errors.
+//
+static Option(Error*) Trap_Round_Decimals(
+    int64_t* out,
+    const REBDEC* buf,
+    REBLEN count,
+    VectorRounding rounding,
+    VectorOverflow overflow,
+    const Cell* vec
+){
+    int64_t min;
+    int64_t max;
+    if (overflow == VECTOR_OVERFLOW_WRAP) {
+        min = INT64_MIN;
+        max = INT64_MAX;
     }
     else
-        panic ("VECTOR!: integer! or decimal! required");
+        Get_Vector_Int64_Range(&min, &max, vec);
+
+    REBDEC dmin = cast(REBDEC, min);  // exact: -2^63 is a power of two
+    REBDEC dmax = (max == INT64_MAX)
+        ? 9223372036854775808.0  // 2^63 (exclusive)
+        : cast(REBDEC, max) + 1.0;  // exact for widths under 64 bits
+
+    REBLEN i;
+    for (i = 0; i < count; ++i) {
+        REBDEC d = buf[i];
+        switch (rounding) {
+          case VECTOR_ROUND_TRUNCATE: d = trunc(d); break;
+          case VECTOR_ROUND_NEAREST: d = round(d); break;
+          case VECTOR_ROUND_FLOOR: d = floor(d); break;
+        }
 
-    ++item;
+        if (d >= dmin and d < dmax) {
+            out[i] = cast(int64_t, d);
+            continue;
+        }
 
-    Byte bitsize;
-    if (item == tail or not Is_Integer(item))
-        panic ("VECTOR!: bit size required, no defaulting");
+        if (overflow == VECTOR_OVERFLOW_SATURATE) {
+            out[i] = (d != d) ? 0 : (d < dmin) ? min : max;  // d != d is NaN
+            continue;
+        }
 
-    REBLEN i = Int32(item);
-    if (i == 8 or i == 16) {
-        if (not integral)
-            panic ("VECTOR!: C doesn't have 8 or 16 bit floating points");
+        DECLARE_ELEMENT (temp);
+        Init_Decimal(temp, buf[i]);
+        return Error_Vector_Out_Of_Range(temp, vec);
     }
-    else if (i != 32 and i != 64)
-        panic ("VECTOR!: C floating points only 32 or 64 bit");
 
-    bitsize = i;
-    ++item;
+    return SUCCESS;
+}
 
-    Byte len = 1;  // !!! default len to 1...why?
-    if (item != tail and Is_Integer(item)) {
-        if (Int32(item) < 0)
-            panic ("VECTOR!: length must be positive");
-        len = Int32(item);
-        ++item;
+
+//=//// NUMERIC TEXT INGESTION ////////////////////////////////////////////=//
+//
+// LOAD-VECTOR parses numbers out of text straight into a vector's binary,
+// without making INTEGER! or DECIMAL! cells (or a BLOCK! to hold them).
+//
+// Integer digits are scanned 8 at a time with "SWAR" (SIMD within a register)
+// tricks on a uint64_t.  Decimals are computed with Clinger's fast path when
+// the mantissa and power of ten are small enough that one multiply or divide
+// gives the correctly rounded result.  Anything else falls back to strtod().
+//
+// 1. The SWAR digit conversion assumes the first character lands in the low
+//    byte of the uint64_t.  Big endian machines use the bytewise loop.
+//
+// 2. Numbers are ASCII, so a token split across two READ:PART calls is held
+//    in a small carry buffer (and not having a buffer big enough for the token
+//    means it can't be a reasonable number anyway).
+//
+// 3. The ingestion routines return errors instead of panicking, so that when
+//    LOAD-VECTOR is reading from a FILE! it can close the port it opened.
+//    Errors raised by READ:PART itself are rescued for the same reason.
+//
+
+#define VECTOR_TOKEN_MAX  64  // longest number accepted, in bytes
+#define VECTOR_INGEST_READ_SIZE  (1024 * 1024)  // bytes per READ:PART of port
+
+typedef struct {
+    Cell* vec;
+    REBLEN len;  // elements flushed into the vector so far
+    REBLEN pending;  // elements in ints[] or decs[] not yet flushed
+    int64_t ints[VECTOR_CHUNK_LEN];
+    REBDEC decs[VECTOR_CHUNK_LEN];
+    Byte carry[VECTOR_TOKEN_MAX];  // partial token from end of last read
+    Size carry_size;
+} VectorIngest;
+
+static const REBDEC g_exact_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+INLINE bool Is_Number_Separator(Byte b) {
+    return b == ' ' or b == '\t' or b == '\r' or b == '\n' or b == ',';
+}
+
+INLINE bool Is_Little_Endian(void) {  // constant folded by the compiler
+    uint16_t u = 1;
+    Byte b;
+    memcpy(&b, &u, 1);
+    return b == 1;
+}
+
+INLINE bool Are_8_Digits(uint64_t v) {
+    return (
+        (v & 0xF0F0F0F0F0F0F0F0ULL) == 0x3030303030303030ULL
+        and ((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL)
+            == 0x3030303030303030ULL
+    );
+}
+
+INLINE uint32_t Parse_8_Digits(uint64_t v) {  // little endian, see [1]
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (
+        ((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)))
+        + (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))
+    ) >> 32;
+    return cast(uint32_t, v);
+}
+
+
+// Returns false if the token isn't a number.  If it is, then *is_integral
+// says whether *i64 or *d was written.
+//
+static bool Parse_Number_Token(
+    int64_t* i64,
+    REBDEC* d,
+    bool* is_integral,
+    const Byte* cp,
+    const Byte* end
+){
+    const Byte* start = cp;
+
+    bool negative = false;
+    if (cp != end and (*cp == '-' or *cp == '+')) {
+        negative = (*cp == '-');
+        ++cp;
+    }
+
+    uint64_t mantissa = 0;
+    int num_digits = 0;  // significant digits in mantissa
+    bool any_digits = false;
+    bool exact = true;  // false if digits were dropped from the mantissa
+    int exponent = 0;
+
+    for (; cp != end and *cp == '0'; ++cp)
+        any_digits = true;  // leading zeros aren't significant
+
+    if (Is_Little_Endian()) {  // see [1]
+        while (end - cp >= 8 and num_digits <= 19 - 8) {
+            uint64_t v;
+            memcpy(&v, cp, sizeof(v));
+            if (not Are_8_Digits(v))
+                break;
+            mantissa = (mantissa * 100000000) + Parse_8_Digits(v);
+            num_digits += 8;
+            cp += 8;
+        }
+    }
+
+    for (; cp != end and *cp >= '0' and *cp <= '9'; ++cp) {
+        if (num_digits < 19) {
+            mantissa = (mantissa * 10) + (*cp - '0');
+            if (mantissa != 0)
+                ++num_digits;
+        }
+        else {
+            exact = false;
+            ++exponent;  // digit dropped, so scale up
+        }
+    }
+    any_digits = any_digits or (num_digits != 0) or (not exact);
+
+    bool integral = true;
+
+    if (cp != end and *cp == '.') {
+        integral = false;
+        for (++cp; cp != end and *cp >= '0' and *cp <= '9'; ++cp) {
+            any_digits = true;
+            if (num_digits < 19) {
+                mantissa = (mantissa * 10) + (*cp - '0');
+                if (mantissa != 0)
+                    ++num_digits;
+                --exponent;
+            }
+            else if (*cp != '0')
+                exact = false;
+        }
+    }
+
+    if (not any_digits)
+        return false;
+
+    if (cp != end and (*cp == 'e' or *cp == 'E')) {
+        integral = false;
+        ++cp;
+
+        bool exp_negative = false;
+        if (cp != end and (*cp == '-' or *cp == '+')) {
+            exp_negative = (*cp == '-');
+            ++cp;
+        }
+        if (cp == end)
+            return false;
+
+        int exp = 0;
+        for (; cp != end and *cp >= '0' and *cp <= '9'; ++cp) {
+            if (exp < 100000)  // beyond any double range, avoid overflow
+                exp = (exp * 10) + (*cp - '0');
+        }
+        exponent += exp_negative ? -exp : exp;
+    }
+
+    if (cp != end)
+        return false;
+
+    if (
+        integral and exact and exponent == 0
+        and mantissa <= cast(uint64_t, INT64_MAX) + (negative ? 1 : 0)
+    ){
+        *is_integral = true;
+        *i64 = negative
+            ? cast(int64_t, 0 - mantissa)  // well defined for INT64_MIN
+            : cast(int64_t, mantissa);
+        return true;
+    }
+
+    *is_integral = false;
+
+    if (
+        exact
+        and mantissa <= (cast(uint64_t, 1) << 53)
+        and exponent >= -22 and exponent <= 22
+    ){
+        *d = cast(REBDEC, mantissa);  // exact, so one rounding below
+        if (exponent < 0)
+            *d /= g_exact_powers_of_ten[-exponent];
+        else
+            *d *= g_exact_powers_of_ten[exponent];
+        if (negative)
+            *d = -(*d);
+        return true;
+    }
+
+    char buf[VECTOR_TOKEN_MAX + 1];  // slow path, strtod() needs terminator
+    Size size = end - start;
+    assert(size <= VECTOR_TOKEN_MAX);
+    memcpy(buf, start, size);
+    buf[size] = '\0';
+
+    char* parsed_end;
+    *d = strtod(buf, &parsed_end);
+    return parsed_end == buf + size;
+}
+
+
+static Option(Error*) Trap_Flush_Vector_Ingest(VectorIngest* ing)  // see [3]
+{
+    if (ing->pending == 0)
+        return SUCCESS;
+
+    Binary* bin = Cell_Binary_Ensure_Mutable(VAL_VECTOR_BLOB(ing->vec));
+    require (
+      Expand_Flex_Tail(bin, ing->pending * VAL_VECTOR_WIDE(ing->vec))
+    );
+
+    if (VAL_VECTOR_INTEGRAL(ing->vec)) {
+        Option(Error*) e = Trap_Store_Vector_Int64s(
+            ing->vec, ing->len, ing->ints, ing->pending, VECTOR_OVERFLOW_ERROR
+        );
+        if (e)
+            return e;
+    }
+    else {
+        Option(Error*) e = Trap_Store_Vector_Decimals(
+            ing->vec, ing->len, ing->decs, ing->pending, VECTOR_OVERFLOW_ERROR
+        );
+        if (e)
+            return e;
+    }
+
+    ing->len += ing->pending;
+    ing->pending = 0;
+    return SUCCESS;
+}
+
+
+// Decimals going into integral vectors truncate, as with Trap_Set_Vector_At()
+//
+static Option(Error*) Trap_Ingest_Number_Token(
+    VectorIngest* ing,
+    const Byte* cp,
+    const Byte* end
+){
+    int64_t i64;
+    REBDEC d;
+    bool is_integral;
+    if (
+        end - cp > VECTOR_TOKEN_MAX
+        or not Parse_Number_Token(&i64, &d, &is_integral, cp, end)
+    ){
+        return Error_User("LOAD-VECTOR: invalid number in input");
+    }
+
+    if (VAL_VECTOR_INTEGRAL(ing->vec)) {
+        if (is_integral)
+            ing->ints[ing->pending] = i64;
+        else {
+            Option(Error*) e = Trap_Round_Decimals(
+                &ing->ints[ing->pending], &d, 1,
+                VECTOR_ROUND_TRUNCATE, VECTOR_OVERFLOW_ERROR, ing->vec
+            );
+            if (e)
+                return e;
+        }
+    }
+    else
+        ing->decs[ing->pending] = is_integral ? cast(REBDEC, i64) : d;
+
+    if (++ing->pending == VECTOR_CHUNK_LEN)
+        return Trap_Flush_Vector_Ingest(ing);
+
+    return SUCCESS;
+}
+
+
+// Call with `final` as false if more text may follow, e.g. from further
+// reads of a port.  Then a number at the very end is held back, see [2].
+//
+static Option(Error*) Trap_Ingest_Vector_Text(
+    VectorIngest* ing,
+    const Byte* cp,
+    const Byte* tail,
+    bool final
+){
+    if (ing->carry_size != 0) {  // finish token split across reads
+        for (; cp != tail and not Is_Number_Separator(*cp); ++cp) {
+            if (ing->carry_size == VECTOR_TOKEN_MAX)
+                return Error_User("LOAD-VECTOR: invalid number in input");
+            ing->carry[ing->carry_size++] = *cp;
+        }
+        if (cp == tail and not final)
+            return SUCCESS;  // still not terminated
+
+        Option(Error*) e = Trap_Ingest_Number_Token(
+            ing, ing->carry, ing->carry + ing->carry_size
+        );
+        if (e)
+            return e;
+        ing->carry_size = 0;
+    }
+
+    while (true) {
+        for (; cp != tail and Is_Number_Separator(*cp); ++cp)
+            NOOP;
+        if (cp == tail)
+            return SUCCESS;
+
+        const Byte* start = cp;
+        for (; cp != tail and not Is_Number_Separator(*cp); ++cp)
+            NOOP;
+
+        if (cp == tail and not final) {
+            if (cp - start > VECTOR_TOKEN_MAX)
+                return Error_User("LOAD-VECTOR: invalid number in input");
+            memcpy(ing->carry, start, cp - start);
+            ing->carry_size = cp - start;
+            return SUCCESS;
+        }
+
+        Option(Error*) e = Trap_Ingest_Number_Token(ing, start, cp);
+        if (e)
+            return e;
+    }
+}
+
+
+// Gives back nullptr in *chunk if the port has no more data.
+//
+static Option(Error*) Trap_Read_Ingest_Chunk(  // see [3]
+    Value** chunk,
+    const Value* port
+){
+    RESCUE_SCOPE_IN_CASE_OF_ABRUPT_FAILURE {
+        *chunk = rebValue("read:part", port, rebI(VECTOR_INGEST_READ_SIZE));
+        CLEANUP_BEFORE_EXITING_RESCUE_SCOPE;
+        return SUCCESS;
+    }
+    ON_ABRUPT_FAILURE(Error* error) {
+        return error;
+    }
+}
+
+
+// Copies of external and compressed vectors are ordinary ones (inline if
+// they're small enough).  Copying is how to get a mutable compressed vector.
+//
+static Element* Copy_Vector(Sink(Element) out, const Cell* vec)
+{
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+
+    Make_Vector(
+        out,
+        len,
+        VAL_VECTOR_SIGN(vec),
+        VAL_VECTOR_INTEGRAL(vec),
+        VAL_VECTOR_BITSIZE(vec)
+    );
+
+    if (not Is_Vector_Compressed(vec)) {
+        Size size = VAL_VECTOR_SIZE(vec);
+        memcpy(VAL_VECTOR_HEAD(out), VAL_VECTOR_HEAD_CONST(vec), size);
+        return out;
+    }
+
+    int64_t buf[VECTOR_CHUNK_LEN];
+
+    REBLEN index;
+    REBLEN count;
+    for (index = 0; index < len; index += count) {
+        count = MIN(len - index, VECTOR_CHUNK_LEN);
+        Load_Vector_Int64s(buf, vec, index, count);
+
+        Option(Error*) e = Trap_Store_Vector_Int64s(
+            out, index, buf, count, VECTOR_OVERFLOW_WRAP  // already in range
+        );
+        assert(not e);
+        UNUSED(e);
+    }
+
+    return out;
+}
+
+
+INLINE Byte Bits_Needed(uint64_t range) {
+    Byte bits = 0;
+    for (; range != 0; range >>= 1)
+        ++bits;
+    return bits;
+}
+
+
+// Pick frame-of-reference or (if allowed, and smaller) delta coding for a
+// block of values.  Fills in all of the head except the offset.
+//
+static void Plan_Vector_Block(
+    VectorBlockHead* head,
+    const int64_t* values,
+    REBLEN n,
+    bool allow_delta
+){
+    assert(n != 0);
+
+    int64_t min = values[0];
+    int64_t max = values[0];
+    REBLEN i;
+    for (i = 1; i < n; ++i) {
+        min = values[i] < min ? values[i] : min;
+        max = values[i] > max ? values[i] : max;
+    }
+
+    head->reference = min;
+    head->first = values[0];
+    head->bits = Bits_Needed(cast(uint64_t, max) - cast(uint64_t, min));
+    head->delta = 0;
+    head->unused[0] = head->unused[1] = 0;
+
+    if (not allow_delta or n < 2)
+        return;
+
+    int64_t dmin = INT64_MAX;
+    int64_t dmax = INT64_MIN;
+    for (i = 1; i < n; ++i) {
+        int64_t d = cast(int64_t,
+            cast(uint64_t, values[i]) - cast(uint64_t, values[i - 1])
+        );
+        dmin = d < dmin ? d : dmin;
+        dmax = d > dmax ? d : dmax;
+    }
+
+    Byte delta_bits = Bits_Needed(cast(uint64_t, dmax) - cast(uint64_t, dmin));
+    if (delta_bits < head->bits) {
+        head->reference = dmin;
+        head->bits = delta_bits;
+        head->delta = 1;
+    }
+}
+
+
+// Packed bytes must be zeroed beforehand, since values are OR'd in.
+//
+static void Pack_Vector_Block(
+    Byte* packed,
+    const int64_t* values,
+    const VectorBlockHead* head,
+    REBLEN n
+){
+    if (head->bits == 0)
+        return;
+
+    uint64_t reference = head->reference;
+
+    REBLEN i;
+    for (i = head->delta ? 1 : 0; i < n; ++i) {
+        uint64_t u = head->delta
+            ? cast(uint64_t, values[i]) - cast(uint64_t, values[i - 1])
+            : cast(uint64_t, values[i]);
+        u -= reference;
+
+        uint64_t bitpos = cast(uint64_t, i) * head->bits;
+        Byte* at = packed + (bitpos / 8);
+        int shift = bitpos % 8;
+
+        uint64_t shifted = u << shift;
+        int k;
+        for (k = 0; k < 8; ++k)
+            at[k] |= cast(Byte, shifted >> (8 * k));
+
+        if (shift + head->bits > 64)
+            at[8] |= cast(Byte, u >> (64 - shift));
+    }
+}
+
+
+static Element* Compress_Vector(
+    Sink(Element) out,
+    const Cell* vec,
+    bool allow_delta
+){
+    assert(VAL_VECTOR_INTEGRAL(vec));
+
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBLEN num_blocks = (len + VECTOR_BLOCK_LEN - 1) / VECTOR_BLOCK_LEN;
+
+    VectorBlockHead* heads = rebAllocN(
+        VectorBlockHead, num_blocks == 0 ? 1 : num_blocks
+    );
+    int64_t values[VECTOR_BLOCK_LEN];
+
+    uint64_t offset = VECTOR_COMPRESSED_HEAD_SIZE
+        + (num_blocks * sizeof(VectorBlockHead));
+
+    REBLEN b;
+    for (b = 0; b < num_blocks; ++b) {
+        REBLEN start = b * VECTOR_BLOCK_LEN;
+        REBLEN n = MIN(len - start, VECTOR_BLOCK_LEN);
+        Load_Vector_Int64s(values, vec, start, n);
+
+        Plan_Vector_Block(&heads[b], values, n, allow_delta);
+        heads[b].offset = offset;
+        offset += ((cast(uint64_t, n) * heads[b].bits) + 7) / 8;
+
+        if (offset > UINT32_MAX)  // rebAlloc() memory freed by panic
+            panic ("VECTOR!: too big to compress");
+    }
+
+    Size size = offset + VECTOR_PACK_PADDING;
+    Binary* bin = Make_Binary(size);
+    Byte* data = Binary_Head(bin);
+    memset(data, 0, size);
+    Term_Binary_Len(bin, size);
+
+    uint64_t len64 = len;
+    memcpy(data, &len64, sizeof(len64));
+    memcpy(
+        data + VECTOR_COMPRESSED_HEAD_SIZE,
+        heads,
+        num_blocks * sizeof(VectorBlockHead)
+    );
+
+    for (b = 0; b < num_blocks; ++b) {
+        REBLEN start = b * VECTOR_BLOCK_LEN;
+        REBLEN n = MIN(len - start, VECTOR_BLOCK_LEN);
+        Load_Vector_Int64s(values, vec, start, n);
+
+        Pack_Vector_Block(data + heads[b].offset, values, &heads[b], n);
+    }
+
+    rebFree(heads);
+
+    return Init_Vector_Compressed(
+        out, bin, VAL_VECTOR_SIGN(vec), VAL_VECTOR_BITSIZE(vec)
+    );
+}
+
+
+//=//// SCANS (RUNNING TOTALS) ////////////////////////////////////////////=//
+//
+// Scans are done chunk by chunk on the unboxed int64_t or double arrays, with
+// the running value carried from one chunk to the next.  The operation is
+// switch()'d on outside the loop, so each loop body is a single operation.
+//
+// 1. Integer sums and products wrap around, as C unsigned arithmetic would.
+//    The low bits of a wrapped sum or product only depend on the low bits of
+//    the inputs, so doing it in 64 bits and then keeping the low bits of the
+//    result gives the same answer as doing it at the element width.
+//
+
+typedef enum {
+    VECTOR_OP_ADD,
+    VECTOR_OP_MULTIPLY,
+    VECTOR_OP_MIN,
+    VECTOR_OP_MAX
+} VectorOp;
+
+static VectorOp Vector_Op_From_Word(const Element* word)
+{
+    assert(Is_Word(word));
+
+    if (Word_Id(word) == SYM_ADD)
+        return VECTOR_OP_ADD;
+    if (Word_Id(word) == SYM_MULTIPLY)
+        return VECTOR_OP_MULTIPLY;
+    if (Word_Id(word) == SYM_MIN)
+        return VECTOR_OP_MIN;
+    if (Word_Id(word) == SYM_MAX)
+        return VECTOR_OP_MAX;
+
+    panic ("VECTOR!: operation must be ADD, MULTIPLY, MIN, or MAX");
+}
+
+#define VECTOR_ADD_WRAP(a,b) \
+    cast(int64_t, cast(uint64_t, (a)) + cast(uint64_t, (b)))  // see [1]
+
+#define VECTOR_MULTIPLY_WRAP(a,b) \
+    cast(int64_t, cast(uint64_t, (a)) * cast(uint64_t, (b)))  // see [1]
+
+#define VECTOR_ADD(a,b)  ((a) + (b))
+#define VECTOR_MULTIPLY(a,b)  ((a) * (b))
+#define VECTOR_MIN(a,b)  ((b) < (a) ? (b) : (a))
+#define VECTOR_MAX(a,b)  ((b) > (a) ? (b) : (a))
+
+#define SCAN_VECTOR_CHUNK(COMBINE) do { \
+    if (exclusive) { \
+        for (i = 0; i < count; ++i) { \
+            x = buf[i]; \
+            buf[i] = *acc; \
+            *acc = COMBINE(*acc, x); \
+        } \
+    } \
+    else { \
+        for (i = 0; i < count; ++i) { \
+            *acc = COMBINE(*acc, buf[i]); \
+            buf[i] = *acc; \
+        } \
+    } \
+} while (0)
+
+
+static void Scan_Int64s(
+    int64_t* buf,
+    REBLEN count,
+    int64_t* acc,  // running value, updated for use by next chunk
+    VectorOp op,
+    bool exclusive
+){
+    REBLEN i;
+    int64_t x;
+
+    switch (op) {
+      case VECTOR_OP_ADD: SCAN_VECTOR_CHUNK(VECTOR_ADD_WRAP); return;
+      case VECTOR_OP_MULTIPLY: SCAN_VECTOR_CHUNK(VECTOR_MULTIPLY_WRAP); return;
+      case VECTOR_OP_MIN: SCAN_VECTOR_CHUNK(VECTOR_MIN); return;
+      case VECTOR_OP_MAX: SCAN_VECTOR_CHUNK(VECTOR_MAX); return;
+    }
+
+    crash ("Unknown vector operation");
+}
+
+
+static void Scan_Decimals(
+    REBDEC* buf,
+    REBLEN count,
+    REBDEC* acc,  // running value, updated for use by next chunk
+    VectorOp op,
+    bool exclusive
+){
+    REBLEN i;
+    REBDEC x;
+
+    switch (op) {
+      case VECTOR_OP_ADD: SCAN_VECTOR_CHUNK(VECTOR_ADD); return;
+      case VECTOR_OP_MULTIPLY: SCAN_VECTOR_CHUNK(VECTOR_MULTIPLY); return;
+      case VECTOR_OP_MIN: SCAN_VECTOR_CHUNK(VECTOR_MIN); return;
+      case VECTOR_OP_MAX: SCAN_VECTOR_CHUNK(VECTOR_MAX); return;
+    }
+
+    crash ("Unknown vector operation");
+}
+
+
+// Exclusive scans start from the identity of the operation, which for MIN
+// and MAX depends on the range of the element type.
+//
+static void Scan_Vector(Cell* vec, VectorOp op, bool exclusive)
+{
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBLEN index;
+    REBLEN count;
+
+    if (not VAL_VECTOR_INTEGRAL(vec)) {
+        REBDEC acc;
+        switch (op) {
+          case VECTOR_OP_ADD: acc = 0.0; break;
+          case VECTOR_OP_MULTIPLY: acc = 1.0; break;
+          case VECTOR_OP_MIN: acc = HUGE_VAL; break;
+          case VECTOR_OP_MAX: acc = -HUGE_VAL; break;
+          default: crash ("Unknown vector operation");
+        }
+
+        REBDEC buf[VECTOR_CHUNK_LEN];
+        for (index = 0; index < len; index += count) {
+            count = MIN(len - index, VECTOR_CHUNK_LEN);
+            Load_Vector_Decimals(buf, vec, index, count);
+            Scan_Decimals(buf, count, &acc, op, exclusive);
+
+            Option(Error*) e = Trap_Store_Vector_Decimals(
+                vec, index, buf, count, VECTOR_OVERFLOW_WRAP
+            );
+            assert(not e);
+            UNUSED(e);
+        }
+        return;
+    }
+
+    int64_t min;
+    int64_t max;
+    Get_Vector_Int64_Range(&min, &max, vec);
+
+    int64_t acc;
+    switch (op) {
+      case VECTOR_OP_ADD: acc = 0; break;
+      case VECTOR_OP_MULTIPLY: acc = 1; break;
+      case VECTOR_OP_MIN: acc = max; break;
+      case VECTOR_OP_MAX: acc = min; break;
+      default: crash ("Unknown vector operation");
+    }
+
+    int64_t buf[VECTOR_CHUNK_LEN];
+    for (index = 0; index < len; index += count) {
+        count = MIN(len - index, VECTOR_CHUNK_LEN);
+        Load_Vector_Int64s(buf, vec, index, count);
+        Scan_Int64s(buf, count, &acc, op, exclusive);
+
+        Option(Error*) e = Trap_Store_Vector_Int64s(
+            vec, index, buf, count, VECTOR_OVERFLOW_WRAP
+        );
+        assert(not e);
+        UNUSED(e);
+    }
+}
+
+
+// out[0] is in[0], and out[N] is in[N] - in[N - 1].  This makes it the
+// inverse of an inclusive ADD scan (integer differences wrap, see [1]).
+//
+static void Delta_Vector(Cell* vec)
+{
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBLEN index;
+    REBLEN count;
+    REBLEN i;
+
+    if (not VAL_VECTOR_INTEGRAL(vec)) {
+        REBDEC prev = 0.0;
+        REBDEC buf[VECTOR_CHUNK_LEN];
+        for (index = 0; index < len; index += count) {
+            count = MIN(len - index, VECTOR_CHUNK_LEN);
+            Load_Vector_Decimals(buf, vec, index, count);
+            for (i = 0; i < count; ++i) {
+                REBDEC x = buf[i];
+                buf[i] = x - prev;
+                prev = x;
+            }
+
+            Option(Error*) e = Trap_Store_Vector_Decimals(
+                vec, index, buf, count, VECTOR_OVERFLOW_WRAP
+            );
+            assert(not e);
+            UNUSED(e);
+        }
+        return;
+    }
+
+    int64_t prev = 0;
+    int64_t buf[VECTOR_CHUNK_LEN];
+    for (index = 0; index < len; index += count) {
+        count = MIN(len - index, VECTOR_CHUNK_LEN);
+        Load_Vector_Int64s(buf, vec, index, count);
+        for (i = 0; i < count; ++i) {
+            int64_t x = buf[i];
+            buf[i] = cast(int64_t, cast(uint64_t, x) - cast(uint64_t, prev));
+            prev = x;
+        }
+
+        Option(Error*) e = Trap_Store_Vector_Int64s(
+            vec, index, buf, count, VECTOR_OVERFLOW_WRAP
+        );
+        assert(not e);
+        UNUSED(e);
+    }
+}
+
+
+//=//// HISTOGRAMS //////////////////////////////////////////////////////=//
+//
+// Counting is done into several interleaved sub-histograms, with consecutive
+// elements going to different ones.  Runs of equal values (which are common,
+// e.g. latencies clustered in one bucket) would otherwise make every
+// increment wait on the store of the previous one to the same counter.  The
+// sub-histograms are summed at the end.
+//
+// Results are signed 64-bit integer vectors, since that's what INTEGER! is.
+//
+
+#define VECTOR_NUM_SUBCOUNTS  4
+
+STATIC_ASSERT(VECTOR_NUM_SUBCOUNTS == 4);  // Count_Integers() is unrolled
+
+
+static Element* Init_Vector_Counts(
+    Sink(Element) out,
+    const int64_t* subcounts,  // VECTOR_NUM_SUBCOUNTS interleaved per bin
+    REBLEN num_bins
+){
+    Make_Vector(out, num_bins, true, true, 64);
+    Byte* data = VAL_VECTOR_HEAD(out);
+
+    REBLEN b;
+    for (b = 0; b < num_bins; ++b) {
+        int64_t total = 0;
+        REBLEN s;
+        for (s = 0; s < VECTOR_NUM_SUBCOUNTS; ++s)
+            total += subcounts[(s * num_bins) + b];
+        memcpy(data + (b * sizeof(int64_t)), &total, sizeof(total));
+    }
+
+    return out;
+}
+
+
+// Bin N counts values in [edges[N], edges[N + 1]), except the last bin is
+// closed on the right so the maximum value of a range gets counted.  Values
+// outside all the bins are not counted, and neither are NaN or infinities.
+//
+// 1. If the edges are evenly spaced, the bin can be computed directly, with
+//    a correction for floating point error right at the edges.  Otherwise it
+//    is a binary search.  Caller must ensure uniform edges span a finite and
+//    nonzero width, so the scale is finite and positive.
+//
+static void Count_Into_Bins(
+    int64_t* subcounts,
+    const Cell* vec,
+    const REBDEC* edges,  // num_bins + 1 of them, ascending
+    REBLEN num_bins,
+    bool uniform  // edges evenly spaced, see [1]
+){
+    REBDEC lo = edges[0];
+    REBDEC hi = edges[num_bins];
+    REBDEC scale = num_bins / (hi - lo);
+    assert(not uniform or (isfinite(scale) and scale > 0.0));  // see [1]
+
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBDEC buf[VECTOR_CHUNK_LEN];
+
+    REBLEN index;
+    REBLEN count;
+    for (index = 0; index < len; index += count) {
+        count = MIN(len - index, VECTOR_CHUNK_LEN);
+        Load_Vector_Decimals(buf, vec, index, count);
+
+        REBLEN i;
+        for (i = 0; i < count; ++i) {
+            REBDEC d = buf[i];
+            if (not isfinite(d) or not (d >= lo and d <= hi))
+                continue;
+
+            REBLEN b;
+            if (uniform) {
+                REBDEC offset = (d - lo) * scale;  // finite, and >= 0
+                b = offset >= num_bins ? num_bins - 1 : cast(REBLEN, offset);
+                if (b > 0 and d < edges[b])
+                    --b;
+                else if (b + 1 < num_bins and d >= edges[b + 1])
+                    ++b;
+            }
+            else {
+                REBLEN low = 0;
+                REBLEN high = num_bins;  // invariant: edges[low] <= d
+                while (high - low > 1) {
+                    REBLEN mid = low + ((high - low) / 2);
+                    if (d < edges[mid])
+                        high = mid;
+                    else
+                        low = mid;
+                }
+                b = low;
+            }
+
+            ++subcounts[((i % VECTOR_NUM_SUBCOUNTS) * num_bins) + b];
+        }
+    }
+}
+
+
+// Bin N counts how many times the integer N appears in the vector.
+//
+static void Count_Integers(
+    int64_t* subcounts,
+    const Cell* vec,
+    REBLEN num_bins
+){
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    int64_t buf[VECTOR_CHUNK_LEN];
+
+    REBLEN index;
+    REBLEN count;
+    for (index = 0; index < len; index += count) {
+        count = MIN(len - index, VECTOR_CHUNK_LEN);
+        Load_Vector_Int64s(buf, vec, index, count);
+
+        int64_t* sub0 = subcounts;
+        int64_t* sub1 = subcounts + num_bins;
+        int64_t* sub2 = subcounts + (2 * num_bins);
+        int64_t* sub3 = subcounts + (3 * num_bins);
+
+        REBLEN i = 0;
+        for (; i + 4 <= count; i += 4) {
+            ++sub0[buf[i]];
+            ++sub1[buf[i + 1]];
+            ++sub2[buf[i + 2]];
+            ++sub3[buf[i + 3]];
+        }
+        for (; i < count; ++i)
+            ++sub0[buf[i]];
+    }
+}
+
+
+//=//// FOLDS (REDUCTIONS) /////////////////////////////////////////////////=//
+//
+// Integer folds are done in 64 bits (wrapping), since the result is an
+// INTEGER! and not an element of the vector.
+//
+// 1. Frame-of-reference blocks of compressed vectors don't have to be
+//    decoded for MIN, since the reference *is* the block's minimum.  MAX and
+//    ADD can work on the packed offsets and apply the reference once.  Only
+//    MULTIPLY and delta-coded blocks need their values reconstructed.
+//
+
+static void Fold_Int64s(
+    int64_t* acc,
+    const int64_t* buf,
+    REBLEN count,
+    VectorOp op
+){
+    int64_t a = *acc;
+    REBLEN i;
+
+    switch (op) {
+      case VECTOR_OP_ADD:
+        for (i = 0; i < count; ++i)
+            a = VECTOR_ADD_WRAP(a, buf[i]);
+        break;
+
+      case VECTOR_OP_MULTIPLY:
+        for (i = 0; i < count; ++i)
+            a = VECTOR_MULTIPLY_WRAP(a, buf[i]);
+        break;
+
+      case VECTOR_OP_MIN:
+        for (i = 0; i < count; ++i)
+            a = VECTOR_MIN(a, buf[i]);
+        break;
+
+      case VECTOR_OP_MAX:
+        for (i = 0; i < count; ++i)
+            a = VECTOR_MAX(a, buf[i]);
+        break;
+    }
+
+    *acc = a;
+}
+
+
+static void Fold_Compressed(int64_t* acc, const Cell* vec, VectorOp op)
+{
+    const Byte* data = Binary_Head(Cell_Binary(VAL_VECTOR_BLOB(vec)));
+    REBLEN len = VAL_VECTOR_COMPRESSED_LEN(vec);
+    int64_t values[VECTOR_BLOCK_LEN];
+
+    REBLEN start;
+    for (start = 0; start < len; start += VECTOR_BLOCK_LEN) {
+        REBLEN n = MIN(len - start, VECTOR_BLOCK_LEN);
+
+        VectorBlockHead head;
+        Get_Vector_Block_Head(&head, data, start / VECTOR_BLOCK_LEN);
+
+        if (head.delta or op == VECTOR_OP_MULTIPLY) {
+            Decode_Vector_Block(values, data, &head, n);
+            Fold_Int64s(acc, values, n, op);
+            continue;
+        }
+
+        if (op == VECTOR_OP_MIN) {  // see [1]
+            *acc = VECTOR_MIN(*acc, head.reference);
+            continue;
+        }
+
+        const Byte* packed = data + head.offset;
+        uint64_t folded = 0;  // sum or max of the packed offsets
+        REBLEN i;
+        if (op == VECTOR_OP_ADD) {
+            for (i = 0; i < n; ++i)
+                folded += Unpack_Bits(packed, i, head.bits);
+            folded += cast(uint64_t, head.reference) * n;
+            *acc = VECTOR_ADD_WRAP(*acc, folded);
+        }
+        else {
+            assert(op == VECTOR_OP_MAX);
+            for (i = 0; i < n; ++i) {
+                uint64_t u = Unpack_Bits(packed, i, head.bits);
+                folded = u > folded ? u : folded;
+            }
+            folded += cast(uint64_t, head.reference);
+            *acc = VECTOR_MAX(*acc, cast(int64_t, folded));
+        }
+    }
+}
+
+
+// Convert a vector to a block (no calls at present)
+//
+static Array* Vector_To_Array(const Element* vec)
+{
+    USED(&Vector_To_Array);
+
+    REBLEN len = Series_Len_At(vec);
+    assert(len >= 0);
+
+    Array* arr = Make_Source(len);
+    Element* dest = Array_Head(arr);
+    REBLEN n;
+    for (n = Series_Index(vec); n < Series_Len_Head(vec); ++n, ++dest)
+        Get_Vector_At(dest, vec, n);
+
+    Set_Flex_Len(arr, len);
+    assert(dest == Array_Tail(arr));
+
+    return arr;
+}
+
+
+//=//// CONTENT HASHING ///////////////////////////////////////////////////=//
+//
+// Vectors hash over their raw bytes, seeded with the sign/integral/width so
+// that an int32 vector and a float32 vector with the same bit patterns don't
+// collide.  This makes the hash consistent with strict (byte-exact) EQUAL?.
+//
+// The algorithm is XXH64: four independent 64-bit lanes consume 32 bytes per
+// round, which keeps them in registers and lets the compiler interleave (or
+// vectorize) the multiplies.  The tail is consumed 8, 4, then 1 byte(s) at a
+// time.  Reads go through memcpy() for the reasons given in Get_Vector_At().
+//
+// !!! Byte order is not normalized, so hashes aren't portable across big and
+// little endian machines.  They are only meant for in-process use.
+//
+
+#define VECTOR_PRIME64_1  0x9E3779B185EBCA87ULL
+#define VECTOR_PRIME64_2  0xC2B2AE3D27D4EB4FULL
+#define VECTOR_PRIME64_3  0x165667B19E3779F9ULL
+#define VECTOR_PRIME64_4  0x85EBCA77C2B2AE63ULL
+#define VECTOR_PRIME64_5  0x27D4EB2F165667C5ULL
+
+INLINE uint64_t Rotl_U64(uint64_t x, int r)
+  { return (x << r) | (x >> (64 - r)); }
+
+INLINE uint64_t Hash_Round_U64(uint64_t acc, const Byte* at) {
+    uint64_t lane;
+    memcpy(&lane, at, sizeof(lane));
+    acc += lane * VECTOR_PRIME64_2;
+    acc = Rotl_U64(acc, 31);
+    return acc * VECTOR_PRIME64_1;
+}
+
+INLINE uint64_t Hash_Merge_U64(uint64_t hash, uint64_t lane) {
+    lane *= VECTOR_PRIME64_2;
+    lane = Rotl_U64(lane, 31);
+    lane *= VECTOR_PRIME64_1;
+    hash ^= lane;
+    return hash * VECTOR_PRIME64_1 + VECTOR_PRIME64_4;
+}
+
+// The lanes are kept in a struct so data that isn't contiguous (e.g. the
+// decoded chunks of a compressed vector) can be hashed 32 bytes at a time.
+//
+typedef struct {
+    uint64_t v1;
+    uint64_t v2;
+    uint64_t v3;
+    uint64_t v4;
+    uint64_t seed;
+    Size size;  // bytes given to Hash_Stripes_U64() so far
+} VectorHasher;
+
+static void Init_Vector_Hasher(VectorHasher* h, uint64_t seed)
+{
+    h->v1 = seed + VECTOR_PRIME64_1 + VECTOR_PRIME64_2;
+    h->v2 = seed + VECTOR_PRIME64_2;
+    h->v3 = seed;
+    h->v4 = seed - VECTOR_PRIME64_1;
+    h->seed = seed;
+    h->size = 0;
+}
+
+static void Hash_Stripes_U64(VectorHasher* h, const Byte* at, Size size)
+{
+    assert(size % 32 == 0);
+    const Byte* tail = at + size;
+
+    for (; at != tail; at += 32) {
+        h->v1 = Hash_Round_U64(h->v1, at);
+        h->v2 = Hash_Round_U64(h->v2, at + 8);
+        h->v3 = Hash_Round_U64(h->v3, at + 16);
+        h->v4 = Hash_Round_U64(h->v4, at + 24);
+    }
+    h->size += size;
+}
+
+// The tail is whatever is left after the last full stripe.
+//
+static uint64_t Finish_Hash_U64(
+    VectorHasher* h,
+    const Byte* at,
+    Size tail_size
+){
+    assert(tail_size < 32);
+    const Byte* tail = at + tail_size;
+    Size size = h->size + tail_size;
+
+    uint64_t hash;
+    if (size >= 32) {
+        hash = Rotl_U64(h->v1, 1) + Rotl_U64(h->v2, 7)
+            + Rotl_U64(h->v3, 12) + Rotl_U64(h->v4, 18);
+        hash = Hash_Merge_U64(hash, h->v1);
+        hash = Hash_Merge_U64(hash, h->v2);
+        hash = Hash_Merge_U64(hash, h->v3);
+        hash = Hash_Merge_U64(hash, h->v4);
+    }
+    else
+        hash = h->seed + VECTOR_PRIME64_5;
+
+    hash += cast(uint64_t, size);
+
+    for (; at + 8 <= tail; at += 8) {
+        hash ^= Hash_Round_U64(0, at);
+        hash = Rotl_U64(hash, 27) * VECTOR_PRIME64_1 + VECTOR_PRIME64_4;
+    }
+
+    if (at + 4 <= tail) {
+        uint32_t half;
+        memcpy(&half, at, sizeof(half));
+        hash ^= cast(uint64_t, half) * VECTOR_PRIME64_1;
+        hash = Rotl_U64(hash, 23) * VECTOR_PRIME64_2 + VECTOR_PRIME64_3;
+        at += 4;
+    }
+
+    for (; at != tail; ++at) {
+        hash ^= (*at) * VECTOR_PRIME64_5;
+        hash = Rotl_U64(hash, 11) * VECTOR_PRIME64_1;
+    }
+
+    hash ^= hash >> 33;  // final avalanche
+    hash *= VECTOR_PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= VECTOR_PRIME64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+static uint64_t Hash_Bytes_U64(const Byte* data, Size size, uint64_t seed)
+{
+    VectorHasher h;
+    Init_Vector_Hasher(&h, seed);
+
+    Size stripes = size - (size % 32);
+    Hash_Stripes_U64(&h, data, stripes);
+    return Finish_Hash_U64(&h, data + stripes, size - stripes);
+}
+
+
+// A compressed vector hashes as the bytes the uncompressed vector would have,
+// decoded one chunk at a time so the whole vector is never expanded.  A full
+// chunk is a multiple of 32 bytes at any element width, so only the last
+// chunk can leave a tail.
+//
+static uint64_t Hash_Compressed_Vector(const Cell* vec, uint64_t seed)
+{
+    STATIC_ASSERT(VECTOR_CHUNK_LEN % 32 == 0);
+
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    Byte wide = VAL_VECTOR_WIDE(vec);
+
+    int64_t buf[VECTOR_CHUNK_LEN];
+    Byte bytes[VECTOR_CHUNK_LEN * sizeof(int64_t)];
+
+    VectorHasher h;
+    Init_Vector_Hasher(&h, seed);
+
+    Size stripes = 0;
+    Size tail_size = 0;
+
+    REBLEN index;
+    REBLEN count;
+    for (index = 0; index < len; index += count) {
+        count = MIN(len - index, VECTOR_CHUNK_LEN);
+        Load_Vector_Int64s(buf, vec, index, count);
+
+        REBLEN i;
+        switch (wide) {  // values are in range, so this keeps the low bytes
+          case 1:
+            for (i = 0; i < count; ++i)
+                bytes[i] = cast(Byte, buf[i]);
+            break;
+
+          case 2:
+            for (i = 0; i < count; ++i) {
+                uint16_t u = cast(uint16_t, buf[i]);
+                memcpy(bytes + (i * 2), &u, sizeof(u));
+            }
+            break;
+
+          case 4:
+            for (i = 0; i < count; ++i) {
+                uint32_t u = cast(uint32_t, buf[i]);
+                memcpy(bytes + (i * 4), &u, sizeof(u));
+            }
+            break;
+
+          case 8:
+            memcpy(bytes, buf, count * sizeof(int64_t));
+            break;
+
+          default:
+            crash ("Unsupported vector element sign/type/size combination");
+        }
+
+        Size size = count * wide;
+        stripes = size - (size % 32);
+        Hash_Stripes_U64(&h, bytes, stripes);
+        tail_size = size - stripes;  // nonzero only for the last chunk
+    }
+
+    return Finish_Hash_U64(&h, bytes + stripes, tail_size);
+}
+
+
+// Large vectors cache their hash in the sign/integral/width cell.  Every
+// write to an existing vector is preceded by Ensure_Vector_Mutable(), which
+// clears VECTOR_FLAG_HASH_CACHED, so the cache lasts until the next mutation.
+// External vectors and vectors whose ADDRESS OF was taken aren't cached, since
+// C code (or an EXTERNAL-VECTOR alias) can write them at any time.
+//
+// 1. The cache slot is pointer-sized, so 32-bit builds don't get caching.
+//
+// 2. Compressed vectors hash the same as the uncompressed equivalent, since
+//    strict equality compares their elements and not their storage.
+//
+static uint64_t Hash_Vector(const Cell* vec)
+{
+    Element* siw = VAL_VECTOR_SIGN_INTEGRAL_WIDE(vec);
+    if (VAL_VECTOR_FLAGS(vec) & VECTOR_FLAG_HASH_CACHED)
+        return siw->payload.split.two.bit;
+
+    uint64_t seed = (VAL_VECTOR_FLAGS(vec) & (
+        VECTOR_FLAG_SIGN | VECTOR_FLAG_INTEGRAL
+    )) | (cast(uint64_t, VAL_VECTOR_WIDE(vec)) << 8);
+
+    Size size = VAL_VECTOR_SIZE(vec);
+    uint64_t hash;
+    if (Is_Vector_Compressed(vec))  // see [2]
+        hash = Hash_Compressed_Vector(vec, seed);
+    else
+        hash = Hash_Bytes_U64(VAL_VECTOR_HEAD_CONST(vec), size, seed);
+
+    if (
+        size >= VECTOR_HASH_CACHE_MIN_SIZE
+        and sizeof(siw->payload.split.two.bit) >= sizeof(uint64_t)  // [1]
+        and not Is_Vector_External(vec)  // C code may write it any time
+        and not (VAL_VECTOR_FLAGS(vec) & VECTOR_FLAG_ADDRESS_TAKEN)
+    ){
+        siw->payload.split.two.bit = hash;
+        VAL_VECTOR_FLAGS(vec) |= VECTOR_FLAG_HASH_CACHED;
+    }
+
+    return hash;
+}
+
+
+IMPLEMENT_GENERIC(HASHIFY, Is_Vector)
+{
+    INCLUDE_PARAMS_OF_HASHIFY;
+
+    Element* vec = Element_ARG(VALUE);
+    return Init_Integer(OUT, cast(int64_t, Hash_Vector(vec)));
+}
+
+
+// !!! Comparison in R3-Alpha was an area that was not well developed.  Ren-C
+// has EQUAL? and LESSER? and builds on that (like Ord and Eq in Haskell, or
+// sorting only on operator< and operator== in C++)
+//
+// For now just define EQUAL?
+//
+// 1. Strict equality is byte-exact: same sign/integral/width, same length,
+//    same bytes.  That's the notion of equality HASHIFY is consistent with,
+//    so vectors can be used as MAP! keys.  (So e.g. 0.0 and -0.0 differ.)
+//    Compressed vectors are compared by their elements, not their storage.
+//
+IMPLEMENT_GENERIC(EQUAL_Q, Is_Vector)
+{
+    INCLUDE_PARAMS_OF_EQUAL_Q;
+
+    Element* v1 = Element_ARG(VALUE1);
+    Element* v2 = Element_ARG(VALUE2);
+
+    if (not ARG(RELAX)) {  // byte-exact, see [1]
+        if (
+            VAL_VECTOR_SIGN(v1) != VAL_VECTOR_SIGN(v2)
+            or VAL_VECTOR_INTEGRAL(v1) != VAL_VECTOR_INTEGRAL(v2)
+            or VAL_VECTOR_WIDE(v1) != VAL_VECTOR_WIDE(v2)
+            or VAL_VECTOR_SIZE(v1) != VAL_VECTOR_SIZE(v2)
+        ){
+            return LOGIC(false);
+        }
+
+        if (
+            (VAL_VECTOR_FLAGS(v1) & VECTOR_FLAG_HASH_CACHED)
+            and (VAL_VECTOR_FLAGS(v2) & VECTOR_FLAG_HASH_CACHED)
+            and Hash_Vector(v1) != Hash_Vector(v2)
+        ){
+            return LOGIC(false);  // cheap rejection if both hashes known
+        }
+
+        if (Is_Vector_Compressed(v1) or Is_Vector_Compressed(v2)) {
+            REBLEN len = VAL_VECTOR_LEN_AT(v1);
+            int64_t buf1[VECTOR_CHUNK_LEN];
+            int64_t buf2[VECTOR_CHUNK_LEN];
+
+            REBLEN index;
+            REBLEN count;
+            for (index = 0; index < len; index += count) {
+                count = MIN(len - index, VECTOR_CHUNK_LEN);
+                Load_Vector_Int64s(buf1, v1, index, count);
+                Load_Vector_Int64s(buf2, v2, index, count);
+                if (0 != memcmp(buf1, buf2, count * sizeof(int64_t)))
+                    return LOGIC(false);
+            }
+            return LOGIC(true);
+        }
+
+        return LOGIC(0 == memcmp(
+            VAL_VECTOR_HEAD_CONST(v1),
+            VAL_VECTOR_HEAD_CONST(v2),
+            VAL_VECTOR_SIZE(v1)
+        ));
+    }
+
+    bool non_integer1 = not VAL_VECTOR_INTEGRAL(v1);
+    bool non_integer2 = not VAL_VECTOR_INTEGRAL(v2);
+    if (non_integer1 != non_integer2)
+        return fail (Error_Not_Same_Type_Raw());  // !!! is thisnecessary?
+
+    REBLEN l1 = VAL_VECTOR_LEN_AT(v1);
+    REBLEN l2 = VAL_VECTOR_LEN_AT(v2);
+    REBLEN len = MIN(l1, l2);
+
+    DECLARE_ELEMENT (temp1);
+    DECLARE_ELEMENT (temp2);
+
+    REBLEN n;
+    for (n = 0; n < len; n++) {
+        Get_Vector_At(temp1, v1, n + VAL_VECTOR_INDEX(v1));
+        Get_Vector_At(temp2, v2, n + VAL_VECTOR_INDEX(v2));
+        if (not rebUnboxLogic(CANON(EQUAL_Q), temp1, temp2))
+            return LOGIC(false);
+    }
+
+    return LOGIC(true);
+}
+
+
+// !!! R3-Alpha code did this shuffle via the bits in the vector, not by
+// extracting into values.  This could use Byte* access to get a similar
+// effect if it were a priority.  Extract and reinsert Cells for now.
+//
+IMPLEMENT_GENERIC(SHUFFLE, Is_Vector)
+{
+    INCLUDE_PARAMS_OF_SHUFFLE;
+
+    Element* vec = Element_ARG(SERIES);
+    bool secure = did ARG(SECURE);
+
+    Ensure_Vector_Mutable(vec);
+
+    REBLEN idx = VAL_VECTOR_INDEX(vec);
+
+    DECLARE_ELEMENT (temp1);
+    DECLARE_ELEMENT (temp2);
+
+    REBLEN n;
+    for (n = VAL_VECTOR_LEN_AT(vec); n > 1;) {
+        REBLEN k = idx + cast(REBLEN, Random_Int(secure)) % n;
+        n--;
+
+        Get_Vector_At(temp1, vec, k);
+        Get_Vector_At(temp2, vec, n + idx);
+
+        Option(Error*) e;
+
+        e = Trap_Set_Vector_At(vec, k, temp2);
+        assert(not e);
+        UNUSED(e);
+
+        e = Trap_Set_Vector_At(vec, n + idx, temp1);
+        assert(not e);
+        UNUSED(e);
+    }
+
+    return COPY(vec);
+}
+
+
+// Parse the `<unsigned> integer!|decimal! bitsize` portion of a vector spec,
+// as used by MAKE VECTOR! and CONVERT-VECTOR.  Returns position after it.
+//
+static const Element* Parse_Vector_Type(
+    bool* sign,
+    bool* integral,
+    Byte* bitsize,
+    const Element* item,
+    const Element* tail
+){
+    *sign = true;  // default to signed, not unsigned
+    if (
+        item != tail
+        and Is_Word(item) and Word_Id(item) == EXT_SYM_UNSIGNED
+    ){
+        *sign = false;
+        ++item;
+    }
+
+    *integral = false;  // default to integer, not floating point
+    if (item == tail or not Is_Word(item))
+        panic (item);
+
+    if (Word_Id(item) == SYM_INTEGER_X)  // e_X_clamation (INTEGER!)
+        *integral = true;
+    else if (Word_Id(item) == SYM_DECIMAL_X) {  // (DECIMAL!)
+        *integral = false;
+        if (not *sign)
+            panic ("VECTOR!: C doesn't have unsigned floating points");
+    }
+    else
+        panic ("VECTOR!: integer! or decimal! required");
+
+    ++item;
+
+    if (item == tail or not Is_Integer(item))
+        panic ("VECTOR!: bit size required, no defaulting");
+
+    REBLEN i = Int32(item);
+    if (i == 8 or i == 16) {
+        if (not *integral)
+            panic ("VECTOR!: C doesn't have 8 or 16 bit floating points");
+    }
+    else if (i != 32 and i != 64)
+        panic ("VECTOR!: C floating points only 32 or 64 bit");
+
+    *bitsize = i;
+    ++item;
+
+    return item;
+}
+
+
+IMPLEMENT_GENERIC(MAKE, Is_Vector)
+{
+    INCLUDE_PARAMS_OF_MAKE;
+    UNUSED(ARG(TYPE));
+
+    Element* spec = Element_ARG(DEF);
+
+    if (Is_Integer(spec) and not Is_Decimal(spec)) {
+        REBINT len = Int32s(spec, 0);
+        if (len < 0)
+            panic (PARAM(DEF));
+
+        Byte bitsize = 32;
+        const bool sign = true;
+        const bool integral = true;
+        return Make_Vector(OUT, len, sign, integral, bitsize);
+    }
+
+    if (not Is_Block(spec))
+        panic (PARAM(DEF));
+
+  //=//// MAKE VECTOR FROM A BLOCK! SPEC //////////////////////////////////=//
+
+    // Make a vector from a block spec.  Binding isn't technically required
+    // if we're only examining the symbols literally.
+    //
+    //    make vector! [integer! 32 100]
+    //    make vector! [decimal! 64 100]
+    //    make vector! [unsigned integer! 32]
+    //    Fields:
+    //         signed:     signed, unsigned
+    //         datatypes:  integer, decimal
+    //         dimensions: 1 - N
+    //         bitsize:    1, 8, 16, 32, 64
+    //         size:       integer units
+    //         init:        block of values
+    //
+    // 1. !!! Note: VECTOR! was an ANY-SERIES!.  But as a user-defined type,
+    //    it is being separated from being the kind of thing that knows how
+    //    series internals are implemented.  It's not clear that user-defined
+    //    types like vectors will be positional.  VAL_VECTOR_INDEX() is always
+    //    0 for now.
+
+    const Element* tail;
+    const Element* item = List_At(&tail, spec);
+
+    bool sign;
+    bool integral;
+    Byte bitsize;
+    item = Parse_Vector_Type(&sign, &integral, &bitsize, item, tail);
+
+    Byte len = 1;  // !!! default len to 1...why?
+    if (item != tail and Is_Integer(item)) {
+        if (Int32(item) < 0)
+            panic ("VECTOR!: length must be positive");
+        len = Int32(item);
+        ++item;
     }
     else
         len = 1;
@@ -484,12 +2290,7 @@ IMPLEMENT_GENERIC(MAKE, Is_Vector)
     if (item != tail)
         panic ("Too many arguments in MAKE VECTOR! block");
 
-    REBLEN num_bytes = len * (bitsize / 8);
-    Binary* bin = Make_Binary(num_bytes);
-    memset(Binary_Head(bin), 0, num_bytes);  // !!! 0 bytes -> 0 int/float?
-    Term_Binary_Len(bin, num_bytes);
-
-    Init_Vector(OUT, bin, sign, integral, bitsize);
+    Make_Vector(OUT, len, sign, integral, bitsize);  // !!! 0 bytes -> 0.0?
     UNUSED(index);  // !!! Not currently used, may (?) be added later
 
     if (iblk != nullptr) {
@@ -558,7 +2359,7 @@ IMPLEMENT_GENERIC(TWEAK_P, Is_Vector)
 
     Element* poke = Known_Element(dual);
 
-    Ensure_Mutable(VAL_VECTOR_BLOB(vec));
+    Ensure_Vector_Mutable(vec);
 
     Option(Error*) e = Trap_Set_Vector_At(vec, n - 1, poke);
     if (e)
@@ -577,11 +2378,29 @@ IMPLEMENT_GENERIC(LENGTH_OF, Is_Vector)
 }
 
 
-IMPLEMENT_GENERIC(ADDRESS_OF, Is_Vector)
-{
-    INCLUDE_PARAMS_OF_ADDRESS_OF;
+// The address is usually handed to C code (e.g. via FFI), which may hold on
+// to it across calls.  So the binary is made fixed size, which means that if
+// it's aliased as a BLOB! then attempts to expand it (and hence relocate the
+// data) will raise errors.  External and inline vectors never move (pairings
+// are not relocated).
+//
+IMPLEMENT_GENERIC(ADDRESS_OF, Is_Vector)
+{
+    INCLUDE_PARAMS_OF_ADDRESS_OF;
+
+    Element* vec = Element_ARG(VALUE);
+
+    if (Is_Vector_Compressed(vec))
+        panic ("Compressed VECTOR! has no C array to give the address of");
+
+    if (not Is_Vector_External(vec) and not Is_Vector_Inline(vec)) {
+        Binary* bin = Cell_Binary_Ensure_Mutable(VAL_VECTOR_BLOB(vec));
+        Set_Flex_Flag(bin, FIXED_SIZE);
+    }
+
+    VAL_VECTOR_FLAGS(vec) &= ~VECTOR_FLAG_HASH_CACHED;  // writes bypass us
+    VAL_VECTOR_FLAGS(vec) |= VECTOR_FLAG_ADDRESS_TAKEN;
 
-    Element* vec = Element_ARG(VALUE);
     return Init_Integer(OUT, i_cast(intptr_t, VAL_VECTOR_HEAD(vec)));
 }
 
@@ -594,19 +2413,7 @@ IMPLEMENT_GENERIC(COPY, Is_Vector) {
     if (ARG(PART) or ARG(DEEP))
         panic (Error_Bad_Refines_Raw());
 
-    require (
-      Binary* bin = u_downcast Copy_Flex_Core(
-        BASE_FLAG_MANAGED,
-        Cell_Binary(VAL_VECTOR_BLOB(vec))
-    ));
-
-    return Init_Vector(
-        OUT,
-        bin,
-        VAL_VECTOR_SIGN(vec),
-        VAL_VECTOR_INTEGRAL(vec),
-        VAL_VECTOR_BITSIZE(vec)
-    );
+    return Copy_Vector(OUT, vec);
 }
 
 
@@ -692,6 +2499,669 @@ IMPLEMENT_GENERIC(MOLDIFY, Is_Vector)
 }
 
 
+//
+//  export convert-vector: native [
+//
+//  "Make a new vector with a different element type, converting each element"
+//
+//      return: [vector!]
+//      vector [vector!]
+//      type "Element type, e.g. [unsigned integer! 8] or [decimal! 32]"
+//          [block!]
+//      :saturate "Clamp out of range values to the nearest representable one"
+//      :wrap "Keep low bits of out of range integers, decimals become inf"
+//      :round "Decimals to integers round to nearest (halves away from 0)"
+//      :floor "Decimals to integers round toward negative infinity"
+//  ]
+//
+DECLARE_NATIVE(CONVERT_VECTOR)
+//
+// Without refinements, out of range values are an error and decimals going
+// to integers are truncated toward zero.
+{
+    INCLUDE_PARAMS_OF_CONVERT_VECTOR;
+
+    Element* vec = Element_ARG(VECTOR);
+
+    if (ARG(SATURATE) and ARG(WRAP))
+        return fail (Error_Bad_Refines_Raw());
+    if (ARG(ROUND) and ARG(FLOOR))
+        return fail (Error_Bad_Refines_Raw());
+
+    VectorOverflow overflow = ARG(SATURATE) ? VECTOR_OVERFLOW_SATURATE
+        : ARG(WRAP) ? VECTOR_OVERFLOW_WRAP
+        : VECTOR_OVERFLOW_ERROR;
+
+    VectorRounding rounding = ARG(ROUND) ? VECTOR_ROUND_NEAREST
+        : ARG(FLOOR) ? VECTOR_ROUND_FLOOR
+        : VECTOR_ROUND_TRUNCATE;
+
+    const Element* tail;
+    const Element* item = List_At(&tail, Element_ARG(TYPE));
+
+    bool sign;
+    bool integral;
+    Byte bitsize;
+    item = Parse_Vector_Type(&sign, &integral, &bitsize, item, tail);
+    if (item != tail)
+        panic ("Too many items in CONVERT-VECTOR type block");
+
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+
+    Make_Vector(OUT, len, sign, integral, bitsize);
+
+    int64_t ints[VECTOR_CHUNK_LEN];
+    REBDEC decs[VECTOR_CHUNK_LEN];
+
+    REBLEN index;
+    REBLEN count;
+    for (index = 0; index < len; index += count) {
+        count = MIN(len - index, VECTOR_CHUNK_LEN);
+
+        if (not integral) {  // anything can become a decimal
+            Load_Vector_Decimals(decs, vec, index, count);
+
+            Option(Error*) e = Trap_Store_Vector_Decimals(
+                OUT, index, decs, count, overflow
+            );
+            if (e)
+                panic (unwrap e);
+            continue;
+        }
+
+        if (VAL_VECTOR_INTEGRAL(vec))
+            Load_Vector_Int64s(ints, vec, index, count);
+        else {
+            Load_Vector_Decimals(decs, vec, index, count);
+            Option(Error*) e = Trap_Round_Decimals(
+                ints, decs, count, rounding, overflow, OUT
+            );
+            if (e)
+                panic (unwrap e);
+        }
+
+        Option(Error*) e = Trap_Store_Vector_Int64s(
+            OUT, index, ints, count, overflow
+        );
+        if (e)
+            panic (unwrap e);
+    }
+
+    return OUT;
+}
+
+
+//
+//  export load-vector: native [
+//
+//  "Parse whitespace or comma separated numbers directly into a new vector"
+//
+//      return: [vector!]
+//      source "Text of numbers, or FILE! or PORT! to read it from in chunks"
+//          [text! blob! file! port!]
+//      type "Element type, e.g. [integer! 32] or [decimal! 64]"
+//          [block!]
+//  ]
+//
+DECLARE_NATIVE(LOAD_VECTOR)
+//
+// This avoids LOAD making a BLOCK! of INTEGER! and DECIMAL! cells just to
+// pass to MAKE VECTOR!, and when reading from a file the text is never all
+// in memory at once either.
+{
+    INCLUDE_PARAMS_OF_LOAD_VECTOR;
+
+    Element* source = Element_ARG(SOURCE);
+
+    const Element* tail;
+    const Element* item = List_At(&tail, Element_ARG(TYPE));
+
+    bool sign;
+    bool integral;
+    Byte bitsize;
+    item = Parse_Vector_Type(&sign, &integral, &bitsize, item, tail);
+    if (item != tail)
+        panic ("Too many items in LOAD-VECTOR type block");
+
+    Binary* bin = Make_Binary(VECTOR_CHUNK_LEN * (bitsize / 8));
+    Term_Binary_Len(bin, 0);
+    Init_Vector(OUT, bin, sign, integral, bitsize);
+
+    VectorIngest ing;
+    ing.vec = OUT;
+    ing.len = 0;
+    ing.pending = 0;
+    ing.carry_size = 0;
+
+    Option(Error*) e;
+
+    if (Is_Text(source) or Is_Blob(source)) {
+        Size size;
+        const Byte* data;
+        if (Is_Blob(source))
+            data = Blob_Size_At(&size, source);
+        else
+            data = cast(const Byte*, Cell_Utf8_Size_At(&size, source));
+
+        e = Trap_Ingest_Vector_Text(&ing, data, data + size, true);
+    }
+    else {
+        Value* port = Is_File(source)
+            ? rebValue("open", source)
+            : rebValue(source);
+
+        while (true) {
+            Value* chunk;
+            e = Trap_Read_Ingest_Chunk(&chunk, port);
+            if (e or not chunk)
+                break;
+
+            Size size;
+            const Byte* data = Blob_Size_At(&size, chunk);
+            e = Trap_Ingest_Vector_Text(&ing, data, data + size, false);
+            rebRelease(chunk);
+
+            if (e or size == 0)
+                break;
+        }
+        if (not e)
+            e = Trap_Ingest_Vector_Text(&ing, nullptr, nullptr, true);
+
+        if (Is_File(source))  // close even if reading or parsing failed
+            rebElide("close", port);
+        rebRelease(port);
+    }
+
+    if (not e)
+        e = Trap_Flush_Vector_Ingest(&ing);
+    if (e)
+        panic (unwrap e);
+
+    assert(ing.len == VAL_VECTOR_LEN_AT(OUT));
+
+    return OUT;
+}
+
+
+//
+//  export vector-scan: native [
+//
+//  "Running totals (or products, minimums, maximums) of a vector's elements"
+//
+//      return: [vector!]
+//      vector "Modified unless :COPY is used"
+//          [vector!]
+//      op "One of ADD, MULTIPLY, MIN, or MAX"
+//          [word!]
+//      :exclusive "Element N gets the result of the elements before N only"
+//      :copy "Return the result as a new vector, leaving the input alone"
+//  ]
+//
+DECLARE_NATIVE(VECTOR_SCAN)
+//
+// Integer sums and products wrap around on overflow, as in C.
+{
+    INCLUDE_PARAMS_OF_VECTOR_SCAN;
+
+    Element* vec = Element_ARG(VECTOR);
+    VectorOp op = Vector_Op_From_Word(Element_ARG(OP));
+
+    if (ARG(COPY))
+        Copy_Vector(OUT, vec);
+    else {
+        Ensure_Vector_Mutable(vec);
+        Copy_Cell(OUT, vec);
+    }
+
+    Scan_Vector(OUT, op, did ARG(EXCLUSIVE));
+    return OUT;
+}
+
+
+//
+//  export vector-delta: native [
+//
+//  "Differences between adjacent elements (the first element is kept as-is)"
+//
+//      return: [vector!]
+//      vector "Modified unless :COPY is used"
+//          [vector!]
+//      :copy "Return the result as a new vector, leaving the input alone"
+//  ]
+//
+DECLARE_NATIVE(VECTOR_DELTA)
+//
+// This is the inverse of VECTOR-SCAN with ADD.
+{
+    INCLUDE_PARAMS_OF_VECTOR_DELTA;
+
+    Element* vec = Element_ARG(VECTOR);
+
+    if (ARG(COPY))
+        Copy_Vector(OUT, vec);
+    else {
+        Ensure_Vector_Mutable(vec);
+        Copy_Cell(OUT, vec);
+    }
+
+    Delta_Vector(OUT);
+    return OUT;
+}
+
+
+//
+//  export vector-histogram: native [
+//
+//  "Count how many of a vector's elements fall into each of a set of bins"
+//
+//      return: "Counts as a 64-bit integer vector, one element per bin"
+//          [vector!]
+//      vector [vector!]
+//      bins "Number of equal width bins, or ascending bin edges"
+//          [integer! block! vector!]
+//      :range "Low and high edge for equal width bins (default is min/max)"
+//          [block!]
+//  ]
+//
+DECLARE_NATIVE(VECTOR_HISTOGRAM)
+//
+// Bins include their low edge but not their high edge, except the last bin
+// includes both.  Elements outside the bins aren't counted.
+{
+    INCLUDE_PARAMS_OF_VECTOR_HISTOGRAM;
+
+    Element* vec = Element_ARG(VECTOR);
+    Element* bins = Element_ARG(BINS);
+
+    if (ARG(RANGE) and not Is_Integer(bins))
+        panic (Error_Bad_Refines_Raw());
+
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+
+    REBLEN num_bins;
+    REBDEC* edges;
+    bool uniform;
+
+    if (Is_Integer(bins)) {
+        if (VAL_INT64(bins) <= 0)
+            panic (PARAM(BINS));
+        num_bins = Int32(bins);
+
+        REBDEC lo;
+        REBDEC hi;
+        if (ARG(RANGE)) {
+            const Element* tail;
+            const Element* at = List_At(&tail, Element_ARG(RANGE));
+            if (
+                tail - at != 2
+                or not (Is_Integer(at) or Is_Decimal(at))
+                or not (Is_Integer(at + 1) or Is_Decimal(at + 1))
+            ){
+                panic (PARAM(RANGE));
+            }
+            lo = Is_Integer(at) ? cast(REBDEC, VAL_INT64(at)) : VAL_DECIMAL(at);
+            hi = Is_Integer(at + 1)
+                ? cast(REBDEC, VAL_INT64(at + 1))
+                : VAL_DECIMAL(at + 1);
+            if (not isfinite(lo) or not isfinite(hi))
+                panic (PARAM(RANGE));
+        }
+        else {  // range of the data (NaN and infinities not considered)
+            lo = HUGE_VAL;
+            hi = -HUGE_VAL;
+
+            REBDEC buf[VECTOR_CHUNK_LEN];
+            REBLEN index;
+            REBLEN count;
+            for (index = 0; index < len; index += count) {
+                count = MIN(len - index, VECTOR_CHUNK_LEN);
+                Load_Vector_Decimals(buf, vec, index, count);
+                REBLEN i;
+                for (i = 0; i < count; ++i) {
+                    if (not isfinite(buf[i]))
+                        continue;
+                    lo = buf[i] < lo ? buf[i] : lo;
+                    hi = buf[i] > hi ? buf[i] : hi;
+                }
+            }
+            if (lo > hi) {  // no finite data
+                lo = 0.0;
+                hi = 1.0;
+            }
+        }
+
+        if (not (lo <= hi))
+            panic ("VECTOR-HISTOGRAM: low edge of range must not exceed high");
+        if (lo == hi) {  // all values go in one bin, centered on them
+            REBDEC pad = fabs(lo) * 1e-9;  // 0.5 wouldn't change e.g. 1e20
+            if (pad < 0.5)
+                pad = 0.5;
+            lo -= pad;
+            hi += pad;
+        }
+
+        REBDEC width = hi - lo;
+        if (not isfinite(width) or not (width > 0.0))
+            panic ("VECTOR-HISTOGRAM: range too wide or narrow for bins");
+
+        edges = rebAllocN(REBDEC, num_bins + 1);
+        REBLEN b;
+        for (b = 0; b < num_bins; ++b)
+            edges[b] = lo + (width * b) / num_bins;
+        edges[num_bins] = hi;
+
+        for (b = 0; b < num_bins; ++b) {
+            if (not (edges[b] < edges[b + 1]))  // rebAlloc() freed by panic
+                panic ("VECTOR-HISTOGRAM: too many bins for the range");
+        }
+        uniform = true;
+    }
+    else {
+        DECLARE_ELEMENT (edge_vec);
+        if (Is_Block(bins)) {
+            const Element* tail;
+            const Element* at = List_At(&tail, bins);
+            for (; at != tail; ++at) {
+                if (not Is_Integer(at) and not Is_Decimal(at))
+                    panic (PARAM(BINS));  // Trap_Set_Vector_Row() asserts
+            }
+
+            Make_Vector(edge_vec, Series_Len_At(bins), true, false, 64);
+
+            Option(Error*) e = Trap_Set_Vector_Row(edge_vec, bins);
+            if (e)
+                panic (unwrap e);
+        }
+        else
+            Copy_Cell(edge_vec, bins);
+
+        REBLEN num_edges = VAL_VECTOR_LEN_AT(edge_vec);
+        if (num_edges < 2)
+            panic ("VECTOR-HISTOGRAM: at least two bin edges needed");
+        num_bins = num_edges - 1;
+
+        edges = rebAllocN(REBDEC, num_edges);
+        REBLEN index;
+        REBLEN count;
+        for (index = 0; index < num_edges; index += count) {
+            count = MIN(num_edges - index, VECTOR_CHUNK_LEN);
+            Load_Vector_Decimals(edges + index, edge_vec, index, count);
+        }
+
+        REBLEN b;
+        for (b = 0; b < num_bins; ++b) {
+            if (not (edges[b] < edges[b + 1]))  // rebAlloc() freed by panic
+                panic ("VECTOR-HISTOGRAM: bin edges must be ascending");
+        }
+        uniform = false;
+    }
+
+    int64_t* subcounts = rebAllocN(int64_t, VECTOR_NUM_SUBCOUNTS * num_bins);
+    memset(subcounts, 0, VECTOR_NUM_SUBCOUNTS * num_bins * sizeof(int64_t));
+
+    Count_Into_Bins(subcounts, vec, edges, num_bins, uniform);
+    Init_Vector_Counts(OUT, subcounts, num_bins);
+
+    rebFree(subcounts);
+    rebFree(edges);
+
+    return OUT;
+}
+
+
+//
+//  export vector-bincount: native [
+//
+//  "Count occurrences of each value in a vector of non-negative integers"
+//
+//      return: "Element N of the result is how many times N appeared"
+//          [vector!]
+//      vector [vector!]
+//      :minlength "Make the result at least this long"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(VECTOR_BINCOUNT)
+//
+// This is meant for small ranges (e.g. status codes or bucket numbers), since
+// the result has an element for every value up to the biggest one.
+{
+    INCLUDE_PARAMS_OF_VECTOR_BINCOUNT;
+
+    Element* vec = Element_ARG(VECTOR);
+
+    if (not VAL_VECTOR_INTEGRAL(vec))
+        panic ("VECTOR-BINCOUNT: vector must be integral");
+
+    int64_t max = -1;
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    int64_t buf[VECTOR_CHUNK_LEN];
+
+    REBLEN index;
+    REBLEN count;
+    for (index = 0; index < len; index += count) {
+        count = MIN(len - index, VECTOR_CHUNK_LEN);
+        Load_Vector_Int64s(buf, vec, index, count);
+
+        int64_t chunk_min = 0;
+        REBLEN i;
+        for (i = 0; i < count; ++i) {
+            chunk_min = buf[i] < chunk_min ? buf[i] : chunk_min;
+            max = buf[i] > max ? buf[i] : max;
+        }
+        if (chunk_min < 0) {
+            DECLARE_ELEMENT (temp);
+            Init_Integer(temp, chunk_min);
+            panic (Error_Out_Of_Range(temp));
+        }
+    }
+
+    int64_t num_bins = max + 1;
+    if (ARG(MINLENGTH)) {
+        if (VAL_INT64(ARG(MINLENGTH)) < 0)
+            panic (PARAM(MINLENGTH));
+        if (VAL_INT64(ARG(MINLENGTH)) > num_bins)
+            num_bins = VAL_INT64(ARG(MINLENGTH));
+    }
+    if (num_bins > INT32_MAX)
+        panic ("VECTOR-BINCOUNT: values too large for a count vector");
+
+    int64_t* subcounts = rebAllocN(
+        int64_t, VECTOR_NUM_SUBCOUNTS * cast(REBLEN, num_bins)
+    );
+    memset(
+        subcounts, 0,
+        VECTOR_NUM_SUBCOUNTS * cast(REBLEN, num_bins) * sizeof(int64_t)
+    );
+
+    Count_Integers(subcounts, vec, num_bins);
+    Init_Vector_Counts(OUT, subcounts, num_bins);
+
+    rebFree(subcounts);
+    return OUT;
+}
+
+
+// Runs when the GC frees the HANDLE! of an external vector.
+//
+static void Vector_External_Cleaner(void* p, size_t length)
+{
+    VectorExternal* ext = cast(VectorExternal*, p);
+    assert(length == sizeof(VectorExternal));
+    UNUSED(length);
+
+    if (ext->release)
+        (*unwrap ext->release)(ext->data);
+
+    rebFree(ext);
+}
+
+
+//
+//  export external-vector: native [
+//
+//  "Make a vector over memory owned by C code, without copying it"
+//
+//      return: [vector!]
+//      address "Address of the first element, e.g. as returned from FFI"
+//          [integer!]
+//      length "Number of elements"
+//          [integer!]
+//      type "Element type, e.g. [integer! 32] or [decimal! 64]"
+//          [block!]
+//      :release "Address of a C `void release(void*)` to call with ADDRESS"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(EXTERNAL_VECTOR)
+//
+// The memory must stay valid until the vector is garbage collected (at which
+// point :RELEASE is called, if given).  COPY of the vector makes an ordinary
+// vector with its own copy of the data.
+{
+    INCLUDE_PARAMS_OF_EXTERNAL_VECTOR;
+
+    if (VAL_INT64(ARG(ADDRESS)) == 0)
+        panic (PARAM(ADDRESS));
+
+    if (VAL_INT64(ARG(LENGTH)) < 0)
+        panic (PARAM(LENGTH));
+
+    const Element* tail;
+    const Element* item = List_At(&tail, Element_ARG(TYPE));
+
+    bool sign;
+    bool integral;
+    Byte bitsize;
+    item = Parse_Vector_Type(&sign, &integral, &bitsize, item, tail);
+    if (item != tail)
+        panic ("Too many items in EXTERNAL-VECTOR type block");
+
+    if (VAL_INT64(ARG(LENGTH)) > INTPTR_MAX / (bitsize / 8))  // size overflow
+        panic (PARAM(LENGTH));
+
+    VectorExternal* ext = rebAlloc(VectorExternal);
+    rebUnmanageMemory(ext);  // lifetime is the handle's, freed by cleaner
+
+    ext->data = p_cast(void*, cast(uintptr_t, VAL_INT64(ARG(ADDRESS))));
+    ext->size = VAL_INT64(ARG(LENGTH)) * (bitsize / 8);
+    if (ARG(RELEASE))
+        ext->release = p_cast(
+            VectorReleaser*, cast(uintptr_t, VAL_INT64(ARG(RELEASE)))
+        );
+    else
+        ext->release = nullptr;
+
+    Value* handle = rebHandle(
+        ext, sizeof(VectorExternal), &Vector_External_Cleaner
+    );
+    Init_Vector_External(OUT, handle, sign, integral, bitsize);
+    rebRelease(handle);
+
+    return OUT;
+}
+
+
+//
+//  export compress-vector: native [
+//
+//  "Make a compressed (read-only) copy of an integer vector"
+//
+//      return: [vector!]
+//      vector [vector!]
+//      :delta "Delta code blocks when it's smaller (e.g. for ascending data)"
+//  ]
+//
+DECLARE_NATIVE(COMPRESS_VECTOR)
+//
+// Elements are stored in blocks of 128, each as offsets from the block's
+// minimum using only as many bits as the block's range needs.  Picking an
+// element still only decodes one value (or one block if delta coded).  COPY
+// of a compressed vector gives back an ordinary mutable vector.
+{
+    INCLUDE_PARAMS_OF_COMPRESS_VECTOR;
+
+    Element* vec = Element_ARG(VECTOR);
+
+    if (not VAL_VECTOR_INTEGRAL(vec))
+        panic ("COMPRESS-VECTOR: only integer vectors can be compressed");
+
+    return Compress_Vector(OUT, vec, did ARG(DELTA));
+}
+
+
+//
+//  export vector-fold: native [
+//
+//  "Combine all of a vector's elements with ADD, MULTIPLY, MIN, or MAX"
+//
+//      return: [integer! decimal!]
+//      vector [vector!]
+//      op "One of ADD, MULTIPLY, MIN, or MAX"
+//          [word!]
+//  ]
+//
+DECLARE_NATIVE(VECTOR_FOLD)
+//
+// An empty vector gives the identity of the operation (e.g. MIN of an empty
+// vector is the largest value its element type can hold).
+{
+    INCLUDE_PARAMS_OF_VECTOR_FOLD;
+
+    Element* vec = Element_ARG(VECTOR);
+    VectorOp op = Vector_Op_From_Word(Element_ARG(OP));
+
+    REBLEN len = VAL_VECTOR_LEN_AT(vec);
+    REBLEN index;
+    REBLEN count;
+
+    if (not VAL_VECTOR_INTEGRAL(vec)) {
+        REBDEC acc;
+        switch (op) {
+          case VECTOR_OP_ADD: acc = 0.0; break;
+          case VECTOR_OP_MULTIPLY: acc = 1.0; break;
+          case VECTOR_OP_MIN: acc = HUGE_VAL; break;
+          case VECTOR_OP_MAX: acc = -HUGE_VAL; break;
+          default: crash ("Unknown vector operation");
+        }
+
+        REBDEC buf[VECTOR_CHUNK_LEN];
+        for (index = 0; index < len; index += count) {
+            count = MIN(len - index, VECTOR_CHUNK_LEN);
+            Load_Vector_Decimals(buf, vec, index, count);
+            Scan_Decimals(buf, count, &acc, op, false);  // acc is the fold
+        }
+        return Init_Decimal(OUT, acc);
+    }
+
+    int64_t min;
+    int64_t max;
+    Get_Vector_Int64_Range(&min, &max, vec);
+
+    int64_t acc;
+    switch (op) {
+      case VECTOR_OP_ADD: acc = 0; break;
+      case VECTOR_OP_MULTIPLY: acc = 1; break;
+      case VECTOR_OP_MIN: acc = max; break;
+      case VECTOR_OP_MAX: acc = min; break;
+      default: crash ("Unknown vector operation");
+    }
+
+    if (Is_Vector_Compressed(vec))
+        Fold_Compressed(&acc, vec, op);
+    else {
+        int64_t buf[VECTOR_CHUNK_LEN];
+        for (index = 0; index < len; index += count) {
+            count = MIN(len - index, VECTOR_CHUNK_LEN);
+            Load_Vector_Int64s(buf, vec, index, count);
+            Fold_Int64s(&acc, buf, count, op);
+        }
+    }
+
+    return Init_Integer(OUT, acc);
+}
+
+
 //
 //  startup*: native [
 //
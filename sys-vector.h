@@ -32,6 +32,21 @@
 // to alias BLOB! data as VECTOR!.  That arbitrary data may already use the
 // Stub.link and Stub.misc for other things.
 //
+// A vector can also be "external", where the first cell of the pairing is a
+// HANDLE! instead of a BLOB!.  This lets C code hand memory it allocated to
+// Rebol as a VECTOR! without copying it.  The handle points to a small
+// VectorExternal struct, and the handle's cleaner runs the optional release
+// function when the GC collects the vector.
+//
+// Integral vectors can also be "compressed".  The BLOB! then doesn't hold the
+// elements as C arrays, but blocks of frame-of-reference + bit-packed (and
+// optionally delta coded) values.  The bit width in the second cell is still
+// that of the logical elements.  Compressed vectors are read-only.
+//
+// Small vectors (e.g. RGB triples or coordinates) are made "inline", with the
+// bytes living in the payload of the pairing's first cell and the byte count
+// in its extra.  That costs one allocation instead of a pairing plus a Binary.
+//
 //=//// NOTES /////////////////////////////////////////////////////////////=//
 //
 // * See %extensions/vector/README.md
@@ -44,18 +59,58 @@ INLINE Vector* VAL_VECTOR(const Cell* v) {
     return cast(Pairing*, CELL_PAYLOAD_1(v));
 }
 
-#define VAL_VECTOR_BLOB(v) \
-    Pairing_First(VAL_VECTOR(v))
-
 #define VAL_VECTOR_SIGN_INTEGRAL_WIDE(v) \
     Pairing_Second(VAL_VECTOR(v))
 
-#define VAL_VECTOR_SIGN(v) \
+// The second cell of the pairing is a HANDLE-hearted cell with its payload
+// marked as not needing GC.  Its first payload slot is used as a bitfield of
+// VECTOR_FLAG_XXX, and its second slot can hold a cached content hash.
+//
+#define VECTOR_FLAG_SIGN  (1 << 0)
+#define VECTOR_FLAG_INTEGRAL  (1 << 1)
+#define VECTOR_FLAG_HASH_CACHED  (1 << 2)  // payload.split.two holds hash
+#define VECTOR_FLAG_EXTERNAL  (1 << 3)  // first cell is HANDLE!, not BLOB!
+#define VECTOR_FLAG_COMPRESSED  (1 << 4)  // BLOB! holds packed blocks
+#define VECTOR_FLAG_INLINE  (1 << 5)  // bytes are in first cell's payload
+#define VECTOR_FLAG_ADDRESS_TAKEN  (1 << 6)  // C code may write it, sticky
+
+#define VECTOR_INLINE_CAPACITY  (2 * sizeof(uintptr_t))  // a cell's payload
+
+#define VAL_VECTOR_FLAGS(v) \
     VAL_VECTOR_SIGN_INTEGRAL_WIDE(v)->payload.split.one.bit
 
+INLINE bool Is_Vector_External(const Cell* v)
+  { return did (VAL_VECTOR_FLAGS(v) & VECTOR_FLAG_EXTERNAL); }
+
+INLINE bool Is_Vector_Compressed(const Cell* v)
+  { return did (VAL_VECTOR_FLAGS(v) & VECTOR_FLAG_COMPRESSED); }
+
+INLINE bool Is_Vector_Inline(const Cell* v)
+  { return did (VAL_VECTOR_FLAGS(v) & VECTOR_FLAG_INLINE); }
+
+INLINE Element* VAL_VECTOR_BLOB(const Cell* v) {
+    assert(not Is_Vector_External(v) and not Is_Vector_Inline(v));
+    return Pairing_First(VAL_VECTOR(v));
+}
+
+typedef void (VectorReleaser)(void* data);
+
+typedef struct {
+    void* data;  // never moves, so ADDRESS OF is stable for FFI calls
+    Size size;
+    Option(VectorReleaser*) release;  // called with data when GC'd
+} VectorExternal;
+
+INLINE VectorExternal* VAL_VECTOR_EXTERNAL(const Cell* v) {
+    assert(Is_Vector_External(v));
+    return Cell_Handle_Pointer(VectorExternal, Pairing_First(VAL_VECTOR(v)));
+}
+
+INLINE bool VAL_VECTOR_SIGN(const Cell* v)
+  { return did (VAL_VECTOR_FLAGS(v) & VECTOR_FLAG_SIGN); }
+
 INLINE bool VAL_VECTOR_INTEGRAL(const Cell* v) {
-    Element* siw = VAL_VECTOR_SIGN_INTEGRAL_WIDE(v);
-    if (siw->payload.split.two.bit != 0)
+    if (VAL_VECTOR_FLAGS(v) & VECTOR_FLAG_INTEGRAL)
         return true;
 
     assert(VAL_VECTOR_SIGN(v));
@@ -64,37 +119,102 @@ INLINE bool VAL_VECTOR_INTEGRAL(const Cell* v) {
 
 INLINE Byte VAL_VECTOR_WIDE(const Cell* v) {  // "wide" Flex term
     int32_t wide = VAL_VECTOR_SIGN_INTEGRAL_WIDE(v)->extra.i32;
-    assert(wide == 1 or wide == 2 or wide == 3 or wide == 4);
+    assert(wide == 1 or wide == 2 or wide == 4 or wide == 8);
     return wide;
 }
 
 #define VAL_VECTOR_BITSIZE(v) \
     (VAL_VECTOR_WIDE(v) * 8)
 
+// Compressed vectors have no C array of elements, so code that wants the
+// data head must check Is_Vector_Compressed() first.
+//
 inline static Byte* VAL_VECTOR_HEAD(const Cell* v) {
+    assert(not Is_Vector_Compressed(v));
+
+    if (Is_Vector_Inline(v))
+        return cast(Byte*, &Pairing_First(VAL_VECTOR(v))->payload);
+
+    if (Is_Vector_External(v))
+        return cast(Byte*, VAL_VECTOR_EXTERNAL(v)->data);
+
     Element* blob = VAL_VECTOR_BLOB(v);
     return Binary_Head(Cell_Binary_Ensure_Mutable(blob));
 }
 
+inline static const Byte* VAL_VECTOR_HEAD_CONST(const Cell* v) {
+    assert(not Is_Vector_Compressed(v));
+
+    if (Is_Vector_Inline(v))
+        return cast(Byte*, &Pairing_First(VAL_VECTOR(v))->payload);
+
+    if (Is_Vector_External(v))
+        return cast(Byte*, VAL_VECTOR_EXTERNAL(v)->data);
+
+    Element* blob = VAL_VECTOR_BLOB(v);
+    return Binary_Head(Cell_Binary(blob));
+}
+
+// A compressed vector's BLOB! starts with its element count.
+//
+inline static REBLEN VAL_VECTOR_COMPRESSED_LEN(const Cell* v) {
+    assert(Is_Vector_Compressed(v));
+
+    uint64_t len;
+    memcpy(&len, Binary_Head(Cell_Binary(VAL_VECTOR_BLOB(v))), sizeof(len));
+    return len;
+}
+
+// This is the size of the elements as C arrays, e.g. as would be compared by
+// memcmp(), not the storage size of a compressed vector.
+//
+inline static Size VAL_VECTOR_SIZE(const Cell* v) {
+    if (Is_Vector_Inline(v))
+        return Pairing_First(VAL_VECTOR(v))->extra.i32;
+
+    if (Is_Vector_External(v))
+        return VAL_VECTOR_EXTERNAL(v)->size;
+
+    if (Is_Vector_Compressed(v))
+        return VAL_VECTOR_COMPRESSED_LEN(v) * VAL_VECTOR_WIDE(v);
+
+    return Series_Len_Head(VAL_VECTOR_BLOB(v));
+}
+
 inline static REBLEN VAL_VECTOR_LEN_AT(const Cell* v) {
-    return Series_Len_Head(VAL_VECTOR_BLOB(v)) / VAL_VECTOR_WIDE(v);
+    return VAL_VECTOR_SIZE(v) / VAL_VECTOR_WIDE(v);
+}
+
+// External memory and inline vectors have no Flex to hold protection bits,
+// so they're always mutable.
+//
+// All code that writes to an existing vector must call this first, because
+// it's what invalidates the cached hash (see Hash_Vector()).
+//
+inline static void Ensure_Vector_Mutable(const Cell* v) {
+    if (Is_Vector_Compressed(v))
+        panic ("Compressed VECTOR! is read-only, COPY it to get a mutable one");
+
+    if (not Is_Vector_External(v) and not Is_Vector_Inline(v))
+        Ensure_Mutable(VAL_VECTOR_BLOB(v));
+
+    VAL_VECTOR_FLAGS(v) &= ~VECTOR_FLAG_HASH_CACHED;
 }
 
+// Content hashes are only cached for vectors at least this big, since for
+// small ones rehashing is as cheap as checking the cache.
+//
+#define VECTOR_HASH_CACHE_MIN_SIZE  1024
+
 #define VAL_VECTOR_INDEX(v) 0  // !!! Index not currently supported
 #define VAL_VECTOR_LEN_HEAD(v) VAL_VECTOR_LEN_AT(v)
 
-inline static Element* Init_Vector(
+inline static Element* Init_Vector_Pairing(
     Sink(Element) out,
-    Binary* bin,
-    bool sign,
-    bool integral,
+    Pairing* paired,  // first cell must already be initialized
+    uintptr_t flags,
     Byte bitsize
 ){
-    Pairing* paired = Alloc_Pairing(BASE_FLAG_MANAGED);
-
-    assert(Binary_Len(bin) % (bitsize / 8) == 0);
-    Init_Blob(Pairing_First(paired), bin);
-
     Element* siw = Pairing_Second(paired);
     Reset_Cell_Header_Noquote(
         siw,
@@ -102,8 +222,8 @@ inline static Element* Init_Vector(
             | CELL_FLAG_DONT_MARK_PAYLOAD_1  // data just a flag, no GC marking
             | CELL_FLAG_DONT_MARK_PAYLOAD_2  // also a flag, no GC marking
     );
-    siw->payload.split.one.bit = sign;
-    siw->payload.split.two.bit = integral;
+    siw->payload.split.one.bit = flags;
+    siw->payload.split.two.bit = 0;  // no hash cached yet
     assert(bitsize == 8 or bitsize == 16 or bitsize == 32 or bitsize == 64);
     siw->extra.i32 = bitsize / 8;  // e.g. VAL_VECTOR_WIDE()
 
@@ -117,3 +237,105 @@ inline static Element* Init_Vector(
 
     return out;
 }
+
+inline static Element* Init_Vector(
+    Sink(Element) out,
+    Binary* bin,
+    bool sign,
+    bool integral,
+    Byte bitsize
+){
+    Pairing* paired = Alloc_Pairing(BASE_FLAG_MANAGED);
+
+    assert(Binary_Len(bin) % (bitsize / 8) == 0);
+    Init_Blob(Pairing_First(paired), bin);
+
+    return Init_Vector_Pairing(
+        out,
+        paired,
+        (sign ? VECTOR_FLAG_SIGN : 0) | (integral ? VECTOR_FLAG_INTEGRAL : 0),
+        bitsize
+    );
+}
+
+// The bytes start out zeroed.
+//
+inline static Element* Init_Vector_Inline(
+    Sink(Element) out,
+    Size size,
+    bool sign,
+    bool integral,
+    Byte bitsize
+){
+    Pairing* paired = Alloc_Pairing(BASE_FLAG_MANAGED);
+
+    Element* first = Pairing_First(paired);
+    Reset_Cell_Header_Noquote(
+        first,
+        FLAG_HEART(TYPE_HANDLE)
+            | CELL_FLAG_DONT_MARK_PAYLOAD_1  // raw bytes, no GC marking
+            | CELL_FLAG_DONT_MARK_PAYLOAD_2  // also raw bytes
+    );
+    assert(size <= VECTOR_INLINE_CAPACITY);
+    assert(size <= sizeof(first->payload));
+    assert(size % (bitsize / 8) == 0);
+    first->extra.i32 = size;  // e.g. VAL_VECTOR_SIZE()
+    memset(&first->payload, 0, sizeof(first->payload));
+
+    return Init_Vector_Pairing(
+        out,
+        paired,
+        VECTOR_FLAG_INLINE
+            | (sign ? VECTOR_FLAG_SIGN : 0)
+            | (integral ? VECTOR_FLAG_INTEGRAL : 0),
+        bitsize
+    );
+}
+
+// The binary must be in the compressed layout made by COMPRESS-VECTOR.
+//
+inline static Element* Init_Vector_Compressed(
+    Sink(Element) out,
+    Binary* bin,
+    bool sign,
+    Byte bitsize
+){
+    Pairing* paired = Alloc_Pairing(BASE_FLAG_MANAGED);
+    Init_Blob(Pairing_First(paired), bin);
+
+    return Init_Vector_Pairing(
+        out,
+        paired,
+        VECTOR_FLAG_COMPRESSED
+            | VECTOR_FLAG_INTEGRAL  // only integers are compressed
+            | (sign ? VECTOR_FLAG_SIGN : 0),
+        bitsize
+    );
+}
+
+// The handle must be a managed HANDLE! whose cdata is a VectorExternal, with
+// a cleaner that will call the release function (see EXTERNAL-VECTOR).
+//
+inline static Element* Init_Vector_External(
+    Sink(Element) out,
+    const Value* handle,
+    bool sign,
+    bool integral,
+    Byte bitsize
+){
+    Pairing* paired = Alloc_Pairing(BASE_FLAG_MANAGED);
+
+    assert(
+        Cell_Handle_Pointer(VectorExternal, handle)->size % (bitsize / 8) == 0
+    );
+    Copy_Cell(Pairing_First(paired), cast(Element*, handle));
+
+    return Init_Vector_Pairing(
+        out,
+        paired,
+        VECTOR_FLAG_EXTERNAL
+            | (sign ? VECTOR_FLAG_SIGN : 0)
+            | (integral ? VECTOR_FLAG_INTEGRAL : 0),
+        bitsize
+    );
+}
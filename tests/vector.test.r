@@ -34,3 +34,229 @@
     v.3: 30
     v = make vector! [integer! 32 [10 20 30]]
 )
+
+; Strict equality is byte-exact, and HASHIFY is consistent with it
+(
+    v1: make vector! [integer! 32 [10 20 30]]
+    v2: make vector! [integer! 32 [10 20 30]]
+    all [
+        equal? v1 v2
+        (hashify v1) = (hashify v2)
+    ]
+)
+(not equal? make vector! [integer! 32 [1 2]] make vector! [integer! 16 [1 2]])
+(equal?:relax make vector! [integer! 32 [1 2]] make vector! [integer! 16 [1 2]])
+(
+    (hashify make vector! [integer! 32 [1 2]])
+        <> (hashify make vector! [unsigned integer! 32 [1 2]])
+)
+
+; Large vectors cache their hash, which must be dropped when they're modified
+(
+    v: make vector! 300
+    h1: hashify v
+    h2: hashify v
+    v.1: 7
+    h3: hashify v
+    v.1: 0
+    all [
+        h1 = h2
+        h1 <> h3
+        h3 <> hashify v
+        h1 = hashify v
+        h1 = hashify copy v
+    ]
+)
+(
+    v: make vector! 300
+    v.1: 1
+    h: hashify v
+    vector-scan v 'add  ; in place, no poke in between
+    h <> hashify v
+)
+(
+    ; writes through ADDRESS OF don't go through the vector, so no caching
+    a: make vector! 300
+    b: make vector! 300
+    b.1: 1
+    hashify a
+    hashify b
+    e: external-vector address of b 300 [integer! 32]
+    e.1: 0
+    equal? a b
+)
+
+; CONVERT-VECTOR
+(
+    ; -2^63 fits in 64 bits, whether it's poked or converted
+    d: make vector! [decimal! 64 [-9.223372036854775808e18]]
+    v: make vector! [integer! 64 [0]]
+    v.1: d.1
+    v = convert-vector d [integer! 64]
+)
+(
+    v: make vector! [decimal! 32 [1.5 -2.5 300.0]]
+    (make vector! [integer! 8 [2 -3 127]]) = convert-vector:saturate:round v [
+        integer! 8
+    ]
+)
+(
+    v: make vector! [decimal! 64 [1.5 -2.5]]
+    (make vector! [integer! 64 [1 -3]]) = convert-vector:floor v [integer! 64]
+)
+(
+    v: make vector! [integer! 16 [256 257 -1]]
+    (make vector! [unsigned integer! 8 [0 1 255]]) = convert-vector:wrap v [
+        unsigned integer! 8
+    ]
+)
+(
+    v: make vector! [integer! 8 [1 2]]
+    (make vector! [decimal! 64 [1.0 2.0]]) = convert-vector v [decimal! 64]
+)
+(
+    v: make vector! [decimal! 64 [1e300 -1e300 1.5]]
+    c: convert-vector:saturate v [decimal! 32]
+    all [
+        c.1 > 3.4e38
+        c.1 < 3.5e38
+        c.2 = negate c.1
+        c.3 = 1.5
+    ]
+)
+(
+    v: make vector! [decimal! 64 [1e300 1.5]]
+    c: convert-vector:wrap v [decimal! 32]
+    all [
+        c.1 > 1e308  ; infinity
+        c.2 = 1.5
+    ]
+)
+
+; LOAD-VECTOR
+(
+    (make vector! [integer! 32 [1 -2 30]]) = load-vector "1, -2^/30" [
+        integer! 32
+    ]
+)
+(
+    (make vector! [integer! 64 [123456789012 -9]]) = load-vector
+        "  123456789012,-9  " [integer! 64]
+)
+(
+    (make vector! [decimal! 64 [1.5 -0.25 1000.0]]) = load-vector
+        "1.5 -25e-2 1e3" [decimal! 64]
+)
+
+; VECTOR-SCAN and VECTOR-DELTA
+(
+    v: make vector! [integer! 32 [1 2 3 4]]
+    vector-scan v 'add
+    v = make vector! [integer! 32 [1 3 6 10]]
+)
+(
+    v: make vector! [integer! 32 [1 2 3 4]]
+    all [
+        (make vector! [integer! 32 [0 1 3 6]]) = vector-scan:exclusive:copy v 'add
+        v = make vector! [integer! 32 [1 2 3 4]]
+    ]
+)
+(
+    (make vector! [decimal! 64 [3.0 1.0 1.0]]) = vector-scan
+        make vector! [decimal! 64 [3.0 1.0 2.0]] 'min
+)
+(
+    (make vector! [integer! 8 [5 -2 4]]) = vector-delta
+        make vector! [integer! 8 [5 3 7]]
+)
+
+; VECTOR-HISTOGRAM and VECTOR-BINCOUNT
+(
+    v: make vector! [decimal! 64 [0.0 0.5 1.0 1.5 2.0 5.0]]
+    (make vector! [integer! 64 [2 3]]) = vector-histogram:range v 2 [0 2]
+)
+(
+    v: make vector! [integer! 32 [1 5 10 50 100 1000]]
+    (make vector! [integer! 64 [2 2 2]]) = vector-histogram v [0 10 100 1000]
+)
+(
+    v: convert-vector:wrap (  ; 1e300 becomes infinity, which isn't counted
+        make vector! [decimal! 64 [0.0 1e300 1.0 2.0]]
+    ) [decimal! 32]
+    (make vector! [integer! 64 [1 2]]) = vector-histogram v 2
+)
+(
+    v: make vector! [decimal! 64 [1e20 1e20]]
+    (make vector! [integer! 64 [0 2 0]]) = vector-histogram v 3
+)
+(
+    v: make vector! [unsigned integer! 8 [0 2 2 3 2]]
+    (make vector! [integer! 64 [1 0 3 1 0]]) = vector-bincount:minlength v 5
+)
+
+; EXTERNAL-VECTOR (here aliasing another vector's pinned memory)
+(
+    v: make vector! [integer! 32 [1 2 3]]
+    e: external-vector address of v 3 [integer! 32]
+    e.2: 20
+    all [
+        v.2 = 20
+        3 = length of e
+        (copy e) = v
+    ]
+)
+
+; COMPRESS-VECTOR and VECTOR-FOLD
+(
+    v: make vector! [integer! 64 [1000 1001 1003 1006 1010]]
+    c: compress-vector:delta v
+    all [
+        5 = length of c
+        c.4 = 1006
+        c = v
+        (hashify c) = (hashify v)
+        5020 = vector-fold c 'add
+        1000 = vector-fold c 'min
+        1010 = vector-fold c 'max
+        (copy c) = v
+    ]
+)
+(
+    v: make vector! [integer! 16 [-5 7 -5 3]]
+    c: compress-vector v
+    all [
+        c = v
+        -5 = vector-fold c 'min
+        7 = vector-fold c 'max
+        0 = vector-fold c 'add
+    ]
+)
+(
+    ; hashed a chunk at a time, with a tail after the last full chunk
+    v: make vector! 300
+    v.1: 5
+    v.299: -7
+    c: compress-vector v
+    all [
+        c = v
+        (hashify c) = (hashify v)
+    ]
+)
+(2.5 = vector-fold make vector! [decimal! 64 [1.0 1.5]] 'add)
+
+; Small vectors are stored inline, copies must still be independent
+(
+    v: make vector! [unsigned integer! 8 [255 128 0]]
+    c: copy v
+    c.1: 1
+    all [
+        v.1 = 255
+        c.1 = 1
+        3 = length of c
+        v = make vector! [unsigned integer! 8 [255 128 0]]
+    ]
+)
+(
+    v: make vector! [integer! 32 [1 2 3]]
+    (hashify v) = (hashify copy v)
+)